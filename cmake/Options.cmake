@@ -7,6 +7,8 @@
 # User-settable options
 option(BITS_BUILD_TESTS   "Build bits unit tests" ON)
 option(BITS_CODE_COVERAGE "Build bits with code coverage" OFF)
+set(BITS_BOUNDS_CHECK "EXCEPTION" CACHE STRING "Default bounds check of bits streams (NONE, ASSERT, EXCEPTION or STATUS)")
+set_property(CACHE BITS_BOUNDS_CHECK PROPERTY STRINGS NONE ASSERT EXCEPTION STATUS)
 
 # Internals options
 set(BITS_CXX_STANDARD "cxx_std_20" CACHE INTERNAL "CXX Standard used to build bits")
@@ -183,6 +183,7 @@ struct TcpHeader {
     uint16_t windowSize;
     uint16_t checksum;
     uint16_t urgentPointer;
+    std::span<const std::byte> data;
 };
 
 EthernetHeader extractEthernetHeader(std::span<const std::byte> buffer)
@@ -199,7 +200,7 @@ EthernetHeader extractEthernetHeader(std::span<const std::byte> buffer)
 
 IpHeader extractIpHeader(std::span<const std::byte> buffer)
 {
-    bits::BitsDeserializer deserializer(buffer);
+    bits::BitsReader deserializer(buffer);
     IpHeader ipHeader;
 
     deserializer
@@ -223,7 +224,7 @@ IpHeader extractIpHeader(std::span<const std::byte> buffer)
 
 TcpHeader extractTcpHeader(std::span<const std::byte> buffer)
 {
-    bits::BitsDeserializer deserializer(buffer);
+    bits::BitsReader deserializer(buffer);
     TcpHeader tcpHeader;
 
     deserializer
@@ -238,6 +239,8 @@ TcpHeader extractTcpHeader(std::span<const std::byte> buffer)
         >>                    tcpHeader.checksum
         >>                    tcpHeader.urgentPointer
     ;
+    deserializer.skip(tcpHeader.dataOffset * 32 - deserializer.nbBitsStreamed());
+    tcpHeader.data = deserializer.view(buffer.size() - (tcpHeader.dataOffset * 4));
 
     return tcpHeader;
 }
@@ -346,10 +349,8 @@ void onPacket(uint8_t * /*args*/, const struct pcap_pkthdr * packet_header, cons
     printf("    "); printIpHeader(ipHeader);
     printf("    "); printTcpHeader(tcpHeader);
 
-    auto dataStart = sizeof(ethernetHeader) + (ipHeader.ihl * 4) + (tcpHeader.dataOffset * 4);
-    printf("    DATA : %lu bytes\n", packet.size() - dataStart);
-    if(dataStart < packet.size())
-        printBuffer(packet.subspan(dataStart));
+    printf("    DATA : %lu bytes\n", tcpHeader.data.size());
+    printBuffer(tcpHeader.data);
 }
 
 int main(int argc, char * argv[])
@@ -9,7 +9,7 @@
 #include <cstddef>
 
 #include <bits/bits.h>
-#include <bits/BitsSerializer.h>
+#include <bits/BitsWriter.h>
 #include <bits/BitsDeserializer.h>
 
 void BME680_read(void)
@@ -133,13 +133,14 @@ void TimeMessage(void)
     std::cout << "Nano second = " << nanoSecond << std::endl;
 
     // Serialize response
-    bits::BitsSerializer serializer(buffer);
-    serializer
+    bits::BitsWriter writer(buffer);
+    writer
         << bits::nbits(2) << MessageType::RESPONSE
         << bits::nbits(2) << MessageGroup::TIME
         << bits::nbits(4) << TimeServices::UPDATE
         << bits::skip(8) // Skip 'length' field
         << bits::nbits(8) << TimeUpdateStatus::SUCCESS;
+    writer.flush();
 
     // ... Write back response message from the buffer ...
 }
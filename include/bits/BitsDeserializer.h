@@ -13,35 +13,53 @@
 #include <span>
 
 #include <bits/bits_extraction.h>
+#include <bits/BitsOrder.h>
+#include <bits/BoundsCheck.h>
 #include <bits/detail/Traits.h>
 #include <bits/detail/BitsStream.h>
 
 namespace bits {
 
 //-----------------------------------------------------------------------------
-//- Bits deserializer class
+//- Bits deserializer class, with the bits order policy used for all
+//- extractions
 //-----------------------------------------------------------------------------
-class BitsDeserializer : public detail::BitsStream<BitsDeserializer>
+template<detail::bits_order Order, detail::bounds_check Bounds = DefaultBoundsCheck>
+class BasicBitsDeserializer : public detail::BitsStream<BasicBitsDeserializer<Order, Bounds>, Bounds>
 {
 public:
-    inline BitsDeserializer(const std::span<const std::byte> buffer, size_t initialOffsetBits = 0);
+    inline BasicBitsDeserializer(const std::span<const std::byte> buffer, size_t initialOffsetBits = 0);
 
     template<detail::output_basic_type T>
     inline T extract(size_t nbBits = sizeof(T) * CHAR_BIT);
     template<detail::output_basic_type T>
-    inline BitsDeserializer & extract(T & val, size_t nbBits = sizeof(T) * CHAR_BIT);
+    inline BasicBitsDeserializer & extract(T & val, size_t nbBits = sizeof(T) * CHAR_BIT);
     template<detail::output_range R>
-    inline BitsDeserializer & extract(R && r, size_t nbBits = sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
+    inline BasicBitsDeserializer & extract(R && r, size_t nbBits = sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
+
+    template<detail::output_basic_type T>
+    inline T peek(size_t nbBits = sizeof(T) * CHAR_BIT);
+
+    inline std::span<const std::byte> view(size_t nbBytes);
 
 protected:
+    using Base = detail::BitsStream<BasicBitsDeserializer<Order, Bounds>, Bounds>;
+    using Base::checkBounds;
+    using Base::checkNbRemainingBits;
+    using Base::posBits;
+    using Base::nbBitsNext;
+
     const std::span<const std::byte> buffer;
 };
 
-template<detail::output_basic_type T>
-inline BitsDeserializer & operator >>(BitsDeserializer & bs, T & val);
-template<detail::output_range R>
-inline BitsDeserializer & operator >>(BitsDeserializer & bs, R && r);
-inline BitsDeserializer & operator >>(BitsDeserializer & bs, const detail::BitsStreamManipulation manip);
+using BitsDeserializer = BasicBitsDeserializer<DefaultBitsOrder>;
+
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::output_basic_type T>
+inline BasicBitsDeserializer<Order, Bounds> & operator >>(BasicBitsDeserializer<Order, Bounds> & bs, T & val);
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::output_range R>
+inline BasicBitsDeserializer<Order, Bounds> & operator >>(BasicBitsDeserializer<Order, Bounds> & bs, R && r);
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicBitsDeserializer<Order, Bounds> & operator >>(BasicBitsDeserializer<Order, Bounds> & bs, const detail::BitsStreamManipulation manip);
 
 
 
@@ -54,30 +72,35 @@ inline BitsDeserializer & operator >>(BitsDeserializer & bs, const detail::BitsS
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-inline BitsDeserializer::BitsDeserializer(const std::span<const std::byte> buffer_, size_t initialOffsetBits)
-: BitsStream(buffer_.size() * CHAR_BIT, initialOffsetBits), buffer(buffer_)
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicBitsDeserializer<Order, Bounds>::BasicBitsDeserializer(const std::span<const std::byte> buffer_, size_t initialOffsetBits)
+: Base(buffer_.size() * CHAR_BIT, initialOffsetBits), buffer(buffer_)
 {}
 
 //-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
 template<detail::output_basic_type T>
-inline T BitsDeserializer::extract(size_t nbBits)
+inline T BasicBitsDeserializer<Order, Bounds>::extract(size_t nbBits)
 {
-    checkNbRemainingBits(nbBits, "Unable to extract bits, too few bits remaining");
+    if(not checkNbRemainingBits(nbBits, "Unable to extract bits, too few bits remaining"))
+        return {};
 
-    auto val = bits::extract<T>(buffer, posBits + nbBits - 1, posBits);
+    auto val = bits::extract<T>(Order{}, buffer, posBits + nbBits - 1, posBits);
     posBits += nbBits;
 
     return val;
 }
 
 //-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
 template<detail::output_basic_type T>
-inline BitsDeserializer & BitsDeserializer::extract(T & val, size_t nbBits)
+inline BasicBitsDeserializer<Order, Bounds> & BasicBitsDeserializer<Order, Bounds>::extract(T & val, size_t nbBits)
 {
     auto nbBitsToExtract = nbBitsNext ? nbBitsNext : nbBits;
-    checkNbRemainingBits(nbBitsToExtract, "Unable to extract bits, too few bits remaining");
+    if(not checkNbRemainingBits(nbBitsToExtract, "Unable to extract bits, too few bits remaining"))
+        return *this;
 
-    bits::extract(buffer, val, posBits + nbBitsToExtract - 1, posBits);
+    bits::extract(Order{}, buffer, val, posBits + nbBitsToExtract - 1, posBits);
     posBits += nbBitsToExtract;
     nbBitsNext = 0;
 
@@ -85,14 +108,16 @@ inline BitsDeserializer & BitsDeserializer::extract(T & val, size_t nbBits)
 }
 
 //-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
 template<detail::output_range R>
-inline BitsDeserializer & BitsDeserializer::extract(R && r, size_t nbBits)
+inline BasicBitsDeserializer<Order, Bounds> & BasicBitsDeserializer<Order, Bounds>::extract(R && r, size_t nbBits)
 {
     auto nbBitsToExtractByElement = nbBitsNext ? nbBitsNext : nbBits;
     auto nbBitsToExtract = nbBitsToExtractByElement * detail::range_size(std::forward<R>(r));
-    checkNbRemainingBits(nbBitsToExtract, "Unable to extract bits, too few bits remaining");
+    if(not checkNbRemainingBits(nbBitsToExtract, "Unable to extract bits, too few bits remaining"))
+        return *this;
 
-    bits::extract(buffer, std::forward<R>(r), posBits + nbBitsToExtract - 1, posBits, nbBitsToExtractByElement);
+    bits::extract(Order{}, buffer, std::forward<R>(r), posBits + nbBitsToExtract - 1, posBits, nbBitsToExtractByElement);
     posBits += nbBitsToExtract;
     nbBitsNext = 0;
 
@@ -100,21 +125,53 @@ inline BitsDeserializer & BitsDeserializer::extract(R && r, size_t nbBits)
 }
 
 //-----------------------------------------------------------------------------
+//- Extract the next bits without moving the position (lookahead)
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
 template<detail::output_basic_type T>
-inline BitsDeserializer & operator >>(BitsDeserializer & bs, T & val)
+inline T BasicBitsDeserializer<Order, Bounds>::peek(size_t nbBits)
+{
+    if(not checkNbRemainingBits(nbBits, "Unable to peek bits, too few bits remaining"))
+        return {};
+
+    return bits::extract<T>(Order{}, buffer, posBits + nbBits - 1, posBits);
+}
+
+//-----------------------------------------------------------------------------
+//- View of the next bytes of the buffer, without copy (the position being
+//- byte aligned, see 'align_to_byte()')
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline std::span<const std::byte> BasicBitsDeserializer<Order, Bounds>::view(size_t nbBytes)
+{
+    if(not checkBounds((posBits % CHAR_BIT) == 0, "Unable to view bytes, position not byte aligned"))
+        return {};
+    if(not checkNbRemainingBits(nbBytes * CHAR_BIT, "Unable to view bytes, too few bits remaining"))
+        return {};
+
+    const auto bytes = buffer.subspan(posBits / CHAR_BIT, nbBytes);
+    posBits += nbBytes * CHAR_BIT;
+
+    return bytes;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::output_basic_type T>
+inline BasicBitsDeserializer<Order, Bounds> & operator >>(BasicBitsDeserializer<Order, Bounds> & bs, T & val)
 {
     return bs.extract(val, sizeof(T) * CHAR_BIT);
 }
 
 //-----------------------------------------------------------------------------
-template<detail::output_range R>
-inline BitsDeserializer & operator >>(BitsDeserializer & bs, R && r)
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::output_range R>
+inline BasicBitsDeserializer<Order, Bounds> & operator >>(BasicBitsDeserializer<Order, Bounds> & bs, R && r)
 {
     return bs.extract(std::forward<R>(r), sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
 }
 
 //-----------------------------------------------------------------------------
-inline BitsDeserializer & operator >>(BitsDeserializer & bs, detail::BitsStreamManipulation manip)
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicBitsDeserializer<Order, Bounds> & operator >>(BasicBitsDeserializer<Order, Bounds> & bs, detail::BitsStreamManipulation manip)
 {
     bs.setManipulation(manip);
     return bs;
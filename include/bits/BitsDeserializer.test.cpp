@@ -13,6 +13,7 @@
 #include <cstddef>
 
 #include <bits/BitsDeserializer.h>
+#include <bits/Uint.h>
 
 using ::testing::ElementsAreArray;
 
@@ -67,6 +68,42 @@ TEST(BitsDeserializer, OutOfRange)
     ASSERT_THROW(stream.skip(128), std::out_of_range);
 }
 
+TEST(BitsDeserializer, BoundsCheck)
+{
+    const std::array<const std::byte, BUFFER_SIZE> buffer = {};
+    bits::BasicBitsDeserializer<bits::MsbFirstBigEndian, bits::ExceptionBounds> checked(buffer);
+    bits::BasicBitsDeserializer<bits::MsbFirstBigEndian, bits::UncheckedBounds> unchecked(buffer);
+
+    static_assert(std::is_same_v<bits::BitsDeserializer, bits::BasicBitsDeserializer<bits::DefaultBitsOrder, bits::DefaultBoundsCheck>>);
+    ASSERT_THROW(checked.skip(65), std::out_of_range);
+    ASSERT_NO_THROW(unchecked.skip(64));
+    ASSERT_EQ(unchecked.nbBitsStreamed(), 64);
+}
+
+TEST(BitsDeserializer, BoundsCheck_Status)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF);
+    bits::BasicBitsDeserializer<bits::MsbFirstBigEndian, bits::StatusBounds> deserializer(buffer);
+    uint16_t val1 = 0;
+    uint64_t val2 = 0;
+    uint8_t val3 = 0;
+
+    deserializer >> val1 >> val2 >> bits::nbits(4) >> val3;
+    ASSERT_TRUE(deserializer.fail());
+    ASSERT_FALSE(deserializer);
+    ASSERT_EQ(val1, 0x35FF);
+    ASSERT_EQ(val2, 0u);
+    ASSERT_EQ(val3, 0u);
+    ASSERT_EQ(deserializer.extract<uint8_t>(), 0u);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 16);
+
+    deserializer.clear();
+    deserializer >> bits::nbits(4) >> val3;
+    ASSERT_TRUE(deserializer.good());
+    ASSERT_EQ(val3, 0x07u);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 20);
+}
+
 //-----------------------------------------------------------------------------
 //- BitsDeserializer specific tests
 //-----------------------------------------------------------------------------
@@ -269,4 +306,106 @@ TEST(BitsDeserializer, Ranges_nbits)
 
     deserializer >> bits::nbits(4) >> array;
     ASSERT_THAT(array, ElementsAreArray(make_array<uint8_t>(0x05, 0x0F, 0x0F, 0x07, 0x00, 0x03 )));
-}
\ No newline at end of file
+}
+TEST(BitsDeserializer, BitsOrder)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF);
+    bits::BasicBitsDeserializer<bits::LsbFirstLittleEndian> deserializer(buffer);
+    uint8_t val1 = 0;
+    uint8_t val2 = 0;
+    uint16_t val3 = 0;
+    uint32_t val4 = 0;
+
+    deserializer.extract(val1, 4).extract(val2, 4);
+    deserializer >> val3 >> val4;
+
+    ASSERT_EQ(val1, 0x05);
+    ASSERT_EQ(val2, 0x03);
+    ASSERT_EQ(val3, 0x70FF);
+    ASSERT_EQ(val4, 0x3570FF35u);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 56);
+}
+
+TEST(BitsDeserializer, Wide)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+    bits::BitsDeserializer deserializer(buffer);
+    uint8_t val1 = 0;
+    bits::uint<96> val2;
+    bits::uint<24> val3;
+
+    deserializer >> val1 >> val2;
+    deserializer.extract(val3, 20);
+
+    ASSERT_EQ(val1, 0x35);
+    ASSERT_EQ(val2, bits::uint<96>(0xFF7035FF, 0x7035FFCAFEBABEA5));
+    ASSERT_EQ(val3, bits::uint<24>(0xB6C7D));
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 124);
+}
+
+TEST(BitsDeserializer, View)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF);
+    bits::BitsDeserializer deserializer(buffer);
+    uint8_t val = 0;
+
+    deserializer >> bits::nbits(4) >> val;
+    ASSERT_THROW(deserializer.view(1), std::out_of_range);
+
+    deserializer >> bits::align_to_byte();
+    const auto bytes = deserializer.view(3);
+    ASSERT_EQ(bytes.data(), buffer.data() + 1);
+    ASSERT_THAT(bytes, ElementsAreArray(make_array(0xFF, 0x70, 0x35)));
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 32);
+
+    deserializer.align_to_byte();
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 32);
+    ASSERT_THROW(deserializer.view(5), std::out_of_range);
+    ASSERT_EQ(deserializer.view(4).size(), 4u);
+    ASSERT_EQ(deserializer.view(0).size(), 0u);
+}
+
+TEST(BitsDeserializer, PeekAndSeek)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF);
+    bits::BitsDeserializer deserializer(buffer);
+
+    ASSERT_EQ(deserializer.peek<uint8_t>(4), 0x03);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 0);
+    ASSERT_EQ(deserializer.extract<uint8_t>(4), 0x03);
+    ASSERT_EQ(deserializer.peek<uint16_t>(12), 0x5FF);
+
+    const auto mark = deserializer.mark();
+    ASSERT_EQ(deserializer.extract<uint16_t>(), 0x5FF7);
+    deserializer.rewind(mark);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 4);
+    ASSERT_EQ(deserializer.extract<uint8_t>(), 0x5F);
+
+    deserializer.seek(40);
+    ASSERT_EQ(deserializer.extract<uint8_t>(), 0x70);
+    deserializer.seek(64);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 64);
+    ASSERT_THROW(deserializer.peek<uint8_t>(1), std::out_of_range);
+    ASSERT_THROW(deserializer.seek(65), std::out_of_range);
+}
+
+TEST(BitsDeserializer, PeekAndSeek_Status)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF);
+    bits::BasicBitsDeserializer<bits::MsbFirstBigEndian, bits::StatusBounds> deserializer(buffer, 4);
+
+    ASSERT_EQ(deserializer.peek<uint8_t>(4), 0x05);
+
+    // Speculative parsing : rewind to the mark when the message is truncated
+    const auto mark = deserializer.mark();
+    deserializer.seek(56).skip(8);
+    ASSERT_TRUE(deserializer.fail());
+    deserializer.rewind(mark);
+    deserializer.clear();
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 0);
+    ASSERT_EQ(deserializer.extract<uint8_t>(), 0x5F);
+
+    deserializer.seek(61);
+    ASSERT_TRUE(deserializer.fail());
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 8);
+}
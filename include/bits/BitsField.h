@@ -23,6 +23,10 @@ class BitsField
     static_assert((sizeof(T) * CHAR_BIT) >= (HIGH - LOW + 1));
 
 public:
+    using value_type = T;
+    static constexpr size_t high = HIGH;
+    static constexpr size_t low  = LOW;
+
     // Constructors and assignments
     constexpr inline BitsField(void) noexcept = default;
     constexpr inline explicit BitsField(const T & val) noexcept;
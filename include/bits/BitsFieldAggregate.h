@@ -0,0 +1,248 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_BITS_FIELD_AGGREGATE_H
+#define BITS_BITS_FIELD_AGGREGATE_H
+
+#include <cstddef>
+#include <climits>
+#include <cassert>
+#include <span>
+#include <array>
+#include <tuple>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+
+#include <bits/bits_insertion.h>
+#include <bits/bits_extraction.h>
+#include <bits/BitsOrder.h>
+#include <bits/BitsField.h>
+
+namespace bits {
+
+namespace detail {
+
+//-----------------------------------------------------------------------------
+//- BitsField traits
+//-----------------------------------------------------------------------------
+template<typename T>
+struct is_bits_field : std::false_type {};
+template<typename T, size_t HIGH, size_t LOW>
+struct is_bits_field<BitsField<T, HIGH, LOW>> : std::true_type {};
+template<typename T>
+inline constexpr bool is_bits_field_v = is_bits_field<std::remove_cvref_t<T>>::value;
+
+//-----------------------------------------------------------------------------
+//- Number of members of an aggregate : the largest number of initializers
+//- it could be initialized with
+//-----------------------------------------------------------------------------
+inline constexpr size_t MAX_AGGREGATE_MEMBERS = 32;
+
+struct any_initializer
+{
+    template<typename T> constexpr operator T(void) const noexcept;
+};
+
+template<typename Aggregate, size_t... I>
+inline constexpr size_t aggregate_size(std::index_sequence<I...>) noexcept;
+
+template<typename Aggregate>
+inline constexpr size_t aggregate_size_v = aggregate_size<Aggregate>(std::index_sequence<>{});
+
+//-----------------------------------------------------------------------------
+//- Tuple of references to the members of an aggregate (structured binding)
+//-----------------------------------------------------------------------------
+template<typename Aggregate>
+inline constexpr auto aggregate_tie(Aggregate & aggregate) noexcept;
+
+template<typename Aggregate>
+using aggregate_members_t = decltype(aggregate_tie(std::declval<Aggregate &>()));
+
+//-----------------------------------------------------------------------------
+//- Concept for the aggregates whose members are all BitsField
+//-----------------------------------------------------------------------------
+template<typename Members>
+inline constexpr bool all_bits_fields_v = false;
+template<typename... T>
+inline constexpr bool all_bits_fields_v<std::tuple<T...>> = (is_bits_field_v<T> and ...);
+
+template<typename T>
+concept bits_field_aggregate = std::is_aggregate_v<T> and (aggregate_size_v<T> > 0) and (aggregate_size_v<T> <= MAX_AGGREGATE_MEMBERS) and all_bits_fields_v<aggregate_members_t<T>>;
+
+//-----------------------------------------------------------------------------
+//- Number of bits spanned by the BitsField members of an aggregate
+//-----------------------------------------------------------------------------
+template<typename Members>
+inline constexpr size_t bits_fields_nb_bits_v = 0;
+template<typename... T>
+inline constexpr size_t bits_fields_nb_bits_v<std::tuple<T...>> = std::max({ std::remove_cvref_t<T>::high... }) + 1;
+
+} // namespace detail
+
+//-----------------------------------------------------------------------------
+//- Aggregate serialization : decode / encode a structure whose members are
+//- all BitsField, each member being extracted from / inserted into the bits
+//- range of its type.
+//-
+//- Members are visited by structured binding, and the bits range of each
+//- member is a compile time constant : encoding is a sequence of the compile
+//- time bits range kernels, one by member, and decoding loads the bytes once
+//- for the members covered by a same word (see 'extract_fields()').
+//-
+//-     struct Control
+//-     {
+//-         bits::BitsField<bool,    0>     enable;
+//-         bits::BitsField<uint8_t, 3, 1>  mode;
+//-         bits::BitsField<uint16_t, 15, 4> divider;
+//-     };
+//-
+//-     auto control = bits::decode<Control>(registers);
+//-     bits::encode(control, registers);
+//-----------------------------------------------------------------------------
+template<detail::bits_field_aggregate Aggregate>
+constexpr Aggregate decode(const std::span<const std::byte> buffer);
+template<detail::bits_field_aggregate Aggregate>
+constexpr void decode(const std::span<const std::byte> buffer, Aggregate & aggregate);
+template<detail::bits_field_aggregate Aggregate>
+constexpr void encode(const Aggregate & aggregate, const std::span<std::byte> buffer);
+
+template<detail::bits_field_aggregate Aggregate, detail::bits_order Order>
+constexpr Aggregate decode(Order order, const std::span<const std::byte> buffer);
+template<detail::bits_order Order, detail::bits_field_aggregate Aggregate>
+constexpr void decode(Order order, const std::span<const std::byte> buffer, Aggregate & aggregate);
+template<detail::bits_order Order, detail::bits_field_aggregate Aggregate>
+constexpr void encode(Order order, const Aggregate & aggregate, const std::span<std::byte> buffer);
+
+
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<detail::bits_field_aggregate Aggregate>
+constexpr Aggregate decode(const std::span<const std::byte> buffer)
+{
+    return decode<Aggregate>(DefaultBitsOrder{}, buffer);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_field_aggregate Aggregate>
+constexpr void decode(const std::span<const std::byte> buffer, Aggregate & aggregate)
+{
+    decode(DefaultBitsOrder{}, buffer, aggregate);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_field_aggregate Aggregate>
+constexpr void encode(const Aggregate & aggregate, const std::span<std::byte> buffer)
+{
+    encode(DefaultBitsOrder{}, aggregate, buffer);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_field_aggregate Aggregate, detail::bits_order Order>
+constexpr Aggregate decode(Order order, const std::span<const std::byte> buffer)
+{
+    Aggregate aggregate = {};
+    decode(order, buffer, aggregate);
+
+    return aggregate;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bits_field_aggregate Aggregate>
+constexpr void decode(Order order, const std::span<const std::byte> buffer, Aggregate & aggregate)
+{
+    assert((buffer.size() * CHAR_BIT) >= detail::bits_fields_nb_bits_v<detail::aggregate_members_t<Aggregate>>);
+
+    std::apply([&]<typename... Fields>(Fields & ... fields)
+    {
+        constexpr std::array<detail::grouped_field, sizeof...(Fields)> ranges = {
+            detail::grouped_field{ Fields::high, Fields::low, 0, detail::groupable_v<typename Fields::value_type> }...
+        };
+        detail::extract_grouped<ranges>(order, buffer, fields.get()...);
+    }, detail::aggregate_tie(aggregate));
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bits_field_aggregate Aggregate>
+constexpr void encode(Order order, const Aggregate & aggregate, const std::span<std::byte> buffer)
+{
+    assert((buffer.size() * CHAR_BIT) >= detail::bits_fields_nb_bits_v<detail::aggregate_members_t<Aggregate>>);
+
+    std::apply([&](const auto & ... fields)
+    {
+        ((bits::insert<std::remove_cvref_t<decltype(fields)>::high, std::remove_cvref_t<decltype(fields)>::low>(order, buffer, fields.get())), ...);
+    }, detail::aggregate_tie(aggregate));
+}
+
+namespace detail {
+
+//-----------------------------------------------------------------------------
+template<typename Aggregate, size_t... I>
+inline constexpr size_t aggregate_size(std::index_sequence<I...>) noexcept
+{
+    if constexpr(sizeof...(I) > MAX_AGGREGATE_MEMBERS)
+        return sizeof...(I);
+    else if constexpr(requires { Aggregate{ (void(I), any_initializer{})..., any_initializer{} }; })
+        return aggregate_size<Aggregate>(std::make_index_sequence<sizeof...(I) + 1>{});
+    else
+        return sizeof...(I);
+}
+
+//-----------------------------------------------------------------------------
+template<typename Aggregate>
+inline constexpr auto aggregate_tie(Aggregate & aggregate) noexcept
+{
+    constexpr size_t nbMembers = aggregate_size_v<std::remove_cv_t<Aggregate>>;
+
+    if constexpr(nbMembers == 1) { auto & [m0] = aggregate; return std::tie(m0); }
+    else if constexpr(nbMembers == 2) { auto & [m0, m1] = aggregate; return std::tie(m0, m1); }
+    else if constexpr(nbMembers == 3) { auto & [m0, m1, m2] = aggregate; return std::tie(m0, m1, m2); }
+    else if constexpr(nbMembers == 4) { auto & [m0, m1, m2, m3] = aggregate; return std::tie(m0, m1, m2, m3); }
+    else if constexpr(nbMembers == 5) { auto & [m0, m1, m2, m3, m4] = aggregate; return std::tie(m0, m1, m2, m3, m4); }
+    else if constexpr(nbMembers == 6) { auto & [m0, m1, m2, m3, m4, m5] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5); }
+    else if constexpr(nbMembers == 7) { auto & [m0, m1, m2, m3, m4, m5, m6] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6); }
+    else if constexpr(nbMembers == 8) { auto & [m0, m1, m2, m3, m4, m5, m6, m7] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7); }
+    else if constexpr(nbMembers == 9) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8); }
+    else if constexpr(nbMembers == 10) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9); }
+    else if constexpr(nbMembers == 11) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10); }
+    else if constexpr(nbMembers == 12) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11); }
+    else if constexpr(nbMembers == 13) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12); }
+    else if constexpr(nbMembers == 14) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13); }
+    else if constexpr(nbMembers == 15) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14); }
+    else if constexpr(nbMembers == 16) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15); }
+    else if constexpr(nbMembers == 17) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16); }
+    else if constexpr(nbMembers == 18) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17); }
+    else if constexpr(nbMembers == 19) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18); }
+    else if constexpr(nbMembers == 20) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19); }
+    else if constexpr(nbMembers == 21) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20); }
+    else if constexpr(nbMembers == 22) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21); }
+    else if constexpr(nbMembers == 23) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22); }
+    else if constexpr(nbMembers == 24) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23); }
+    else if constexpr(nbMembers == 25) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24); }
+    else if constexpr(nbMembers == 26) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25); }
+    else if constexpr(nbMembers == 27) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26); }
+    else if constexpr(nbMembers == 28) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27); }
+    else if constexpr(nbMembers == 29) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28); }
+    else if constexpr(nbMembers == 30) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29); }
+    else if constexpr(nbMembers == 31) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30); }
+    else if constexpr(nbMembers == 32) { auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31] = aggregate; return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31); }
+    else
+        return std::tuple<>{};
+}
+
+} // namespace detail
+
+} // namespace bits
+
+#endif /* BITS_BITS_FIELD_AGGREGATE_H */
@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <array>
+#include <cstddef>
+
+#include <bits/BitsFieldAggregate.h>
+#include <bits/BitsDeserializer.h>
+
+using ::testing::ElementsAreArray;
+
+template<typename T = std::byte, typename... Ts>
+constexpr std::array<T, sizeof...(Ts)> make_array(Ts && ... args) noexcept
+{
+    return { T(std::forward<Ts>(args))... };
+}
+
+enum class Mode : uint8_t { IDLE = 0, RUN = 5, STOP = 7 };
+
+struct Control
+{
+    bits::BitsField<bool,     0>      enable;
+    bits::BitsField<Mode,     3, 1>   mode;
+    bits::BitsField<uint16_t, 15, 4>  divider;
+    bits::BitsField<int8_t,   23, 20> offset;
+};
+
+const auto REGISTERS = make_array(0xDA, 0xCF, 0x5E);
+
+//-----------------------------------------------------------------------------
+//- Aggregates of BitsField members
+//-----------------------------------------------------------------------------
+TEST(BitsFieldAggregate, Traits)
+{
+    struct NotOnlyBitsFields
+    {
+        bits::BitsField<uint8_t, 7, 0> field;
+        uint8_t value;
+    };
+
+    static_assert(bits::detail::aggregate_size_v<Control> == 4);
+    static_assert(bits::detail::bits_field_aggregate<Control>);
+    static_assert(not bits::detail::bits_field_aggregate<NotOnlyBitsFields>);
+    static_assert(bits::detail::bits_fields_nb_bits_v<bits::detail::aggregate_members_t<Control>> == 24);
+}
+
+TEST(BitsFieldAggregate, Decode)
+{
+    const auto control = bits::decode<Control>(REGISTERS);
+
+    ASSERT_EQ(control.enable, true);
+    ASSERT_EQ(control.mode, Mode::RUN);
+    ASSERT_EQ(control.divider, 0xACF);
+    ASSERT_EQ(control.offset, -2);
+}
+
+TEST(BitsFieldAggregate, Decode_ConstantEvaluated)
+{
+    constexpr auto control = bits::decode<Control>(REGISTERS);
+
+    static_assert(control.mode.get() == Mode::RUN);
+    static_assert(control.divider.get() == 0xACF);
+}
+
+TEST(BitsFieldAggregate, Encode)
+{
+    Control control = {};
+    control.enable  = true;
+    control.mode    = Mode::RUN;
+    control.divider = 0xACF;
+    control.offset  = -2;
+
+    auto buffer = make_array(0x00, 0x00, 0xFF);
+    bits::encode(control, buffer);
+
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDA, 0xCF, 0xFE)));
+}
+
+TEST(BitsFieldAggregate, OtherBitsOrder)
+{
+    auto control = bits::decode<Control>(bits::LsbFirstLittleEndian{}, REGISTERS);
+    bits::BasicBitsDeserializer<bits::LsbFirstLittleEndian> deserializer(REGISTERS);
+    bool enable = false;
+    Mode mode = Mode::IDLE;
+    uint16_t divider = 0;
+    int8_t offset = 0;
+
+    deserializer.extract(enable, 1).extract(mode, 3).extract(divider, 12).skip(4).extract(offset, 4);
+    ASSERT_EQ(control.enable, enable);
+    ASSERT_EQ(control.mode, mode);
+    ASSERT_EQ(control.divider, divider);
+    ASSERT_EQ(control.offset, offset);
+
+    std::array<std::byte, 3> buffer = {};
+    bits::encode(bits::LsbFirstLittleEndian{}, control, buffer);
+    bits::decode(bits::LsbFirstLittleEndian{}, buffer, control);
+    ASSERT_EQ(control.divider, divider);
+    ASSERT_EQ(control.offset, offset);
+}
@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_BITS_ORDER_H
+#define BITS_BITS_ORDER_H
+
+#include <bit>
+#include <type_traits>
+
+namespace bits {
+
+//-----------------------------------------------------------------------------
+//- Bits numbering inside the buffer :
+//-     - MSB_FIRST : bit 0 is the most significant bit of byte 0
+//-     - LSB_FIRST : bit 0 is the least significant bit of byte 0
+//-----------------------------------------------------------------------------
+enum class BitOrder
+{
+    MSB_FIRST,
+    LSB_FIRST,
+};
+
+//-----------------------------------------------------------------------------
+//- Bits order policy, selecting at compile time :
+//-     - the bits numbering inside the buffer
+//-     - the bytes order of multi-bytes fields
+//-
+//- With MSB_FIRST numbering, fields are naturally big endian : the first bit
+//- of the field (bit 'low') is the most significant bit of the value.
+//- With LSB_FIRST numbering, fields are naturally little endian : the first
+//- bit of the field (bit 'low') is the least significant bit of the value
+//- (CAN DBC 'Intel' signals, LSB-first bit streams).
+//- Selecting the other byte order swaps the bytes of the value, which then
+//- should be a whole number of bytes (USB descriptors, little endian
+//- registers read from a MSB-first stream).
+//-----------------------------------------------------------------------------
+template<BitOrder bitOrder, std::endian byteOrder>
+struct BitsOrder
+{
+    static_assert(byteOrder == std::endian::big or byteOrder == std::endian::little);
+
+    static constexpr BitOrder    bit_order          = bitOrder;
+    static constexpr std::endian byte_order         = byteOrder;
+    static constexpr std::endian natural_byte_order = (bitOrder == BitOrder::MSB_FIRST) ? std::endian::big : std::endian::little;
+    static constexpr bool        swap_bytes         = (byteOrder != natural_byte_order);
+};
+
+using MsbFirstBigEndian    = BitsOrder<BitOrder::MSB_FIRST, std::endian::big>;
+using MsbFirstLittleEndian = BitsOrder<BitOrder::MSB_FIRST, std::endian::little>;
+using LsbFirstLittleEndian = BitsOrder<BitOrder::LSB_FIRST, std::endian::little>;
+using LsbFirstBigEndian    = BitsOrder<BitOrder::LSB_FIRST, std::endian::big>;
+
+using DefaultBitsOrder = MsbFirstBigEndian;
+
+//-----------------------------------------------------------------------------
+//- Bits order tags, to be passed as first parameter of insertion / extraction
+//- functions
+//-----------------------------------------------------------------------------
+inline constexpr MsbFirstBigEndian    msb_first_big_endian    = {};
+inline constexpr MsbFirstLittleEndian msb_first_little_endian = {};
+inline constexpr LsbFirstLittleEndian lsb_first_little_endian = {};
+inline constexpr LsbFirstBigEndian    lsb_first_big_endian    = {};
+
+namespace detail {
+
+//-----------------------------------------------------------------------------
+//- Trait and concept to check if a type is a bits order policy
+//-----------------------------------------------------------------------------
+template<typename T>                                  struct is_bits_order : std::false_type {};
+template<BitOrder bitOrder, std::endian byteOrder>    struct is_bits_order<BitsOrder<bitOrder, byteOrder>> : std::true_type {};
+
+template<typename T> inline constexpr bool is_bits_order_v = is_bits_order<std::remove_cvref_t<T>>::value;
+
+template<typename T>
+concept bits_order = is_bits_order_v<T>;
+
+} // namespace detail
+
+} // namespace bits
+
+#endif /* BITS_BITS_ORDER_H */
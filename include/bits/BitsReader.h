@@ -0,0 +1,299 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_BITS_READER_H
+#define BITS_BITS_READER_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <climits>
+#include <span>
+
+#include <bits/bits_extraction.h>
+#include <bits/BitsOrder.h>
+#include <bits/BoundsCheck.h>
+#include <bits/detail/Traits.h>
+#include <bits/detail/BitsStream.h>
+#include <bits/detail/underlying_integral_type.h>
+#include <bits/detail/word_access.h>
+
+namespace bits {
+
+//-----------------------------------------------------------------------------
+//- Bits reader class : a bits deserializer holding a 64 bits cache of the
+//- buffer, refilled with whole word loads. Consecutive fields are served from
+//- the cache by shifting and masking, so that a chain of small fields costs
+//- about one load per 8 bytes.
+//-
+//- The cache covers the bits [cacheStart, cacheEnd) of the buffer, so that
+//- skipping or resetting the stream doesn't need to invalidate it. Wide
+//- fields and ranges are extracted directly from the buffer.
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds = DefaultBoundsCheck>
+class BasicBitsReader : public detail::BitsStream<BasicBitsReader<Order, Bounds>, Bounds>
+{
+public:
+    inline BasicBitsReader(const std::span<const std::byte> buffer, size_t initialOffsetBits = 0);
+
+    template<detail::output_basic_type T>
+    inline T extract(size_t nbBits = sizeof(T) * CHAR_BIT);
+    template<detail::output_basic_type T>
+    inline BasicBitsReader & extract(T & val, size_t nbBits = sizeof(T) * CHAR_BIT);
+    template<detail::output_range R>
+    inline BasicBitsReader & extract(R && r, size_t nbBits = sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
+
+    template<detail::output_basic_type T>
+    inline T peek(size_t nbBits = sizeof(T) * CHAR_BIT);
+
+    inline std::span<const std::byte> view(size_t nbBytes);
+
+protected:
+    using Base = detail::BitsStream<BasicBitsReader<Order, Bounds>, Bounds>;
+    using Base::checkBounds;
+    using Base::checkNbRemainingBits;
+    using Base::posBits;
+    using Base::nbBitsNext;
+
+    inline bool           isCached(size_t pos, size_t nbBits) const noexcept;
+    inline void           refill(size_t pos) noexcept;
+    inline detail::word_t cachedBits(size_t pos, size_t nbBits) noexcept;
+    inline detail::word_t readBits(size_t nbBits) noexcept;
+
+    template<typename T> inline void extractField(T & val, size_t nbBits);
+
+    const std::span<const std::byte> buffer;
+
+    detail::word_t cache;
+    size_t cacheStart;
+    size_t cacheEnd;
+};
+
+using BitsReader = BasicBitsReader<DefaultBitsOrder>;
+
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::output_basic_type T>
+inline BasicBitsReader<Order, Bounds> & operator >>(BasicBitsReader<Order, Bounds> & bs, T & val);
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::output_range R>
+inline BasicBitsReader<Order, Bounds> & operator >>(BasicBitsReader<Order, Bounds> & bs, R && r);
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicBitsReader<Order, Bounds> & operator >>(BasicBitsReader<Order, Bounds> & bs, const detail::BitsStreamManipulation manip);
+
+
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicBitsReader<Order, Bounds>::BasicBitsReader(const std::span<const std::byte> buffer_, size_t initialOffsetBits)
+: Base(buffer_.size() * CHAR_BIT, initialOffsetBits), buffer(buffer_), cache(0), cacheStart(0), cacheEnd(0)
+{}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<detail::output_basic_type T>
+inline T BasicBitsReader<Order, Bounds>::extract(size_t nbBits)
+{
+    if(not checkNbRemainingBits(nbBits, "Unable to extract bits, too few bits remaining"))
+        return {};
+
+    T val = {};
+    extractField(val, nbBits);
+    posBits += nbBits;
+
+    return val;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<detail::output_basic_type T>
+inline BasicBitsReader<Order, Bounds> & BasicBitsReader<Order, Bounds>::extract(T & val, size_t nbBits)
+{
+    auto nbBitsToExtract = nbBitsNext ? nbBitsNext : nbBits;
+    if(not checkNbRemainingBits(nbBitsToExtract, "Unable to extract bits, too few bits remaining"))
+        return *this;
+
+    extractField(val, nbBitsToExtract);
+    posBits += nbBitsToExtract;
+    nbBitsNext = 0;
+
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<detail::output_range R>
+inline BasicBitsReader<Order, Bounds> & BasicBitsReader<Order, Bounds>::extract(R && r, size_t nbBits)
+{
+    auto nbBitsToExtractByElement = nbBitsNext ? nbBitsNext : nbBits;
+    auto nbBitsToExtract = nbBitsToExtractByElement * detail::range_size(std::forward<R>(r));
+    if(not checkNbRemainingBits(nbBitsToExtract, "Unable to extract bits, too few bits remaining"))
+        return *this;
+
+    bits::extract(Order{}, buffer, std::forward<R>(r), posBits + nbBitsToExtract - 1, posBits, nbBitsToExtractByElement);
+    posBits += nbBitsToExtract;
+    nbBitsNext = 0;
+
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+//- Extract the next bits without moving the position (lookahead)
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<detail::output_basic_type T>
+inline T BasicBitsReader<Order, Bounds>::peek(size_t nbBits)
+{
+    if(not checkNbRemainingBits(nbBits, "Unable to peek bits, too few bits remaining"))
+        return {};
+
+    T val = {};
+    extractField(val, nbBits);
+
+    return val;
+}
+
+//-----------------------------------------------------------------------------
+//- View of the next bytes of the buffer, without copy (the position being
+//- byte aligned, see 'align_to_byte()')
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline std::span<const std::byte> BasicBitsReader<Order, Bounds>::view(size_t nbBytes)
+{
+    if(not checkBounds((posBits % CHAR_BIT) == 0, "Unable to view bytes, position not byte aligned"))
+        return {};
+    if(not checkNbRemainingBits(nbBytes * CHAR_BIT, "Unable to view bytes, too few bits remaining"))
+        return {};
+
+    const auto bytes = buffer.subspan(posBits / CHAR_BIT, nbBytes);
+    posBits += nbBytes * CHAR_BIT;
+
+    return bytes;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline bool BasicBitsReader<Order, Bounds>::isCached(size_t pos, size_t nbBits) const noexcept
+{
+    return pos >= cacheStart and (pos + nbBits) <= cacheEnd;
+}
+
+//-----------------------------------------------------------------------------
+//- The cache is refilled from the byte of the position, with a whole word load
+//- (or the remaining bytes at the end of the buffer). With MSB first
+//- numbering, the cached bits are left aligned into the cache, and right
+//- aligned with LSB first numbering.
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline void BasicBitsReader<Order, Bounds>::refill(size_t pos) noexcept
+{
+    constexpr auto loadOrder = (Order::bit_order == BitOrder::LSB_FIRST) ? std::endian::little : std::endian::big;
+    const auto index = pos / CHAR_BIT;
+    size_t nbBytes = detail::WORD_BYTES;
+
+    if((index + detail::WORD_BYTES) <= buffer.size())
+        cache = detail::load<detail::WORD_BYTES, loadOrder>(buffer, index);
+    else
+    {
+        nbBytes = (index < buffer.size()) ? (buffer.size() - index) : 0;
+        cache   = detail::load_partial<loadOrder>(buffer, index, nbBytes);
+        if constexpr(Order::bit_order == BitOrder::MSB_FIRST)
+            cache = nbBytes ? (cache << ((detail::WORD_BYTES - nbBytes) * CHAR_BIT)) : 0;
+    }
+
+    cacheStart = index * CHAR_BIT;
+    cacheEnd   = cacheStart + nbBytes * CHAR_BIT;
+}
+
+//-----------------------------------------------------------------------------
+//- Up to 57 bits are always served by the cache once refilled (as the cache
+//- starts at most 7 bits before the position)
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline detail::word_t BasicBitsReader<Order, Bounds>::cachedBits(size_t pos, size_t nbBits) noexcept
+{
+    if(not isCached(pos, nbBits))
+        refill(pos);
+
+    const auto offset = pos - cacheStart;
+
+    if constexpr(Order::bit_order == BitOrder::LSB_FIRST)
+        return (cache >> offset) & detail::mask_64bits(nbBits);
+    else
+        return (cache << offset) >> (detail::WORD_BITS - nbBits);
+}
+
+//-----------------------------------------------------------------------------
+//- Fields of more than 57 bits (which may cross the cache) are read in two
+//- parts, the first bits being the most significant ones with MSB first
+//- numbering and the least significant ones with LSB first numbering.
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline detail::word_t BasicBitsReader<Order, Bounds>::readBits(size_t nbBits) noexcept
+{
+    constexpr size_t HALF_WORD_BITS = detail::WORD_BITS / 2;
+
+    if(nbBits == 0)
+        return 0;
+    else if(nbBits <= (detail::WORD_BITS - CHAR_BIT + 1))
+        return cachedBits(posBits, nbBits);
+    else if constexpr(Order::bit_order == BitOrder::LSB_FIRST)
+        return cachedBits(posBits, HALF_WORD_BITS) | (cachedBits(posBits + HALF_WORD_BITS, nbBits - HALF_WORD_BITS) << HALF_WORD_BITS);
+    else
+        return (cachedBits(posBits, nbBits - HALF_WORD_BITS) << HALF_WORD_BITS) | cachedBits(posBits + nbBits - HALF_WORD_BITS, HALF_WORD_BITS);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<typename T>
+inline void BasicBitsReader<Order, Bounds>::extractField(T & val, size_t nbBits)
+{
+    if constexpr(detail::IsWideInteger<T>::value)
+        bits::extract(Order{}, buffer, val, posBits + nbBits - 1, posBits);
+    else
+    {
+        auto rawVal = readBits(nbBits);
+
+        if constexpr(Order::swap_bytes)
+            rawVal = detail::swap_value_bytes(rawVal, nbBits);
+
+        if constexpr(std::is_signed_v<T>)
+            if(nbBits > 0 and nbBits < detail::WORD_BITS)
+                rawVal = static_cast<detail::word_t>(static_cast<int64_t>(rawVal << (detail::WORD_BITS - nbBits)) >> (detail::WORD_BITS - nbBits));
+
+        val = static_cast<T>(static_cast<detail::underlying_integral_type_t<T>>(rawVal));
+    }
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::output_basic_type T>
+inline BasicBitsReader<Order, Bounds> & operator >>(BasicBitsReader<Order, Bounds> & bs, T & val)
+{
+    return bs.extract(val, sizeof(T) * CHAR_BIT);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::output_range R>
+inline BasicBitsReader<Order, Bounds> & operator >>(BasicBitsReader<Order, Bounds> & bs, R && r)
+{
+    return bs.extract(std::forward<R>(r), sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicBitsReader<Order, Bounds> & operator >>(BasicBitsReader<Order, Bounds> & bs, detail::BitsStreamManipulation manip)
+{
+    bs.setManipulation(manip);
+    return bs;
+}
+
+} // namespace bits
+
+#endif /* BITS_BITS_READER_H */
@@ -0,0 +1,264 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <array>
+#include <span>
+#include <vector>
+#include <cstddef>
+
+#include <bits/BitsReader.h>
+#include <bits/BitsDeserializer.h>
+#include <bits/Uint.h>
+
+using ::testing::ElementsAreArray;
+
+template<typename T = std::byte, typename... Ts>
+constexpr std::array<const T, sizeof...(Ts)> make_array(Ts && ... args) noexcept
+{
+    return { T(std::forward<Ts>(args))... };
+}
+
+const size_t BUFFER_SIZE = 8;
+
+//-----------------------------------------------------------------------------
+//- Reader / Deserializer common tests
+//-----------------------------------------------------------------------------
+TEST(BitsReader, OutOfRange)
+{
+    const std::array<const std::byte, BUFFER_SIZE> buffer = {};
+    bits::BitsReader reader(buffer);
+
+    ASSERT_THROW(reader.skip(128), std::out_of_range);
+    ASSERT_THROW(reader.extract<uint8_t>(65), std::out_of_range);
+}
+
+TEST(BitsReader, NbBitsRead)
+{
+    const std::array<const std::byte, BUFFER_SIZE> buffer = {};
+    bits::BitsReader reader(buffer);
+
+    ASSERT_EQ(reader.nbBitsStreamed(), 0);
+    reader.extract<uint8_t>(4); ASSERT_EQ(reader.nbBitsStreamed(), 4);
+    reader.extract<uint8_t>(2); ASSERT_EQ(reader.nbBitsStreamed(), 6);
+    reader.extract<uint8_t>();  ASSERT_EQ(reader.nbBitsStreamed(), 14);
+    reader.extract<uint8_t>();  ASSERT_EQ(reader.nbBitsStreamed(), 22);
+    reader.extract<uint8_t>();  ASSERT_EQ(reader.nbBitsStreamed(), 30);
+}
+
+TEST(BitsReader, ChainedExtract)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF);
+    bits::BitsReader reader(buffer);
+    uint8_t val1 = 0;
+    uint8_t val2 = 0;
+    uint8_t val3 = 0;
+    uint8_t val4 = 0;
+    uint8_t val5 = 0;
+
+    reader
+        .extract(val1, 4)
+        .extract(val2, 2)
+        .extract(val3, 8)
+        .extract(val4, 8)
+        .extract(val5, 8)
+    ;
+
+    ASSERT_EQ(val1, 0x03);
+    ASSERT_EQ(val2, 0x01);
+    ASSERT_EQ(val3, 0x7F);
+    ASSERT_EQ(val4, 0xDC);
+    ASSERT_EQ(val5, 0x0D);
+}
+
+TEST(BitsReader, ChainedExtract_Operator)
+{
+    const auto buffer = make_array(0xD8, 0xE9, 0xA5, 0xA5, 0xB6, 0xB6, 0xB6, 0xB6, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7);
+    bits::BitsReader reader(buffer);
+    uint8_t val1 = 0;
+    uint8_t val2 = 0;
+    uint16_t val3 = 0;
+    uint32_t val4 = 0;
+    uint64_t val5 = 0;
+
+    reader
+        >> val1
+        >> val2
+        >> val3
+        >> val4
+        >> val5
+    ;
+
+    ASSERT_EQ(val1, 0xD8);
+    ASSERT_EQ(val2, 0xE9);
+    ASSERT_EQ(val3, 0xA5A5);
+    ASSERT_EQ(val4, 0xB6B6'B6B6);
+    ASSERT_EQ(val5, 0xC7C7'C7C7'C7C7'C7C7);
+}
+
+TEST(BitsReader, BitsManipulation_SkipAndReset)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+    bits::BitsReader reader(buffer);
+    uint16_t val1 = 0;
+    uint16_t val2 = 0;
+    uint16_t val3 = 0;
+
+    reader >> bits::skip(76) >> val1 >> bits::reset() >> bits::skip(12) >> val2 >> bits::reset() >> bits::skip(76) >> val3;
+
+    ASSERT_EQ(val1, 0xEBAB);
+    ASSERT_EQ(val2, 0xF703);
+    ASSERT_EQ(val3, 0xEBAB);
+    ASSERT_EQ(reader.nbBitsStreamed(), 92);
+}
+
+//-----------------------------------------------------------------------------
+//- BitsReader specific tests
+//-----------------------------------------------------------------------------
+TEST(BitsReader, Signed)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF);
+    bits::BitsReader reader(buffer, 8);
+
+    ASSERT_EQ(reader.extract<int16_t>(12), -9);
+    ASSERT_EQ(reader.extract<int8_t>(4), 0);
+    ASSERT_EQ(reader.extract<int8_t>(), 0x35);
+    ASSERT_EQ(reader.extract<int64_t>(32), -9'423'361);
+}
+
+TEST(BitsReader, Fields_CrossingCache)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+    bits::BitsReader reader(buffer, 4);
+
+    ASSERT_EQ(reader.extract<uint64_t>(), 0x5FF7035F'F7035FFCu);
+    ASSERT_EQ(reader.extract<uint64_t>(60), 0x0AFEBABE'A5B6C7D8u);
+}
+
+TEST(BitsReader, Buffer_tail)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF);
+    bits::BitsReader reader(buffer);
+
+    ASSERT_EQ(reader.extract<uint16_t>(12), 0x35F);
+    ASSERT_EQ(reader.extract<uint16_t>(12), 0xF70);
+    ASSERT_EQ(reader.extract<uint16_t>(16), 0x35FF);
+}
+
+TEST(BitsReader, Ranges)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF);
+    bits::BitsReader reader(buffer, 4);
+    std::array<uint8_t, 3> array = {};
+    std::vector<uint8_t> vector(2, 0);
+
+    reader >> array >> bits::nbits(4) >> vector;
+
+    ASSERT_THAT(array, ElementsAreArray(make_array<uint8_t>(0x5F, 0xF7, 0x03)));
+    ASSERT_THAT(vector, ElementsAreArray(make_array<uint8_t>(0x05, 0x0F)));
+    ASSERT_EQ(reader.nbBitsStreamed(), 32);
+}
+
+TEST(BitsReader, BitsOrder)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF);
+    bits::BasicBitsReader<bits::LsbFirstLittleEndian> reader(buffer);
+    uint8_t val1 = 0;
+    uint8_t val2 = 0;
+    uint16_t val3 = 0;
+    uint32_t val4 = 0;
+
+    reader.extract(val1, 4).extract(val2, 4);
+    reader >> val3 >> val4;
+
+    ASSERT_EQ(val1, 0x05);
+    ASSERT_EQ(val2, 0x03);
+    ASSERT_EQ(val3, 0x70FF);
+    ASSERT_EQ(val4, 0x3570FF35u);
+    ASSERT_EQ(reader.nbBitsStreamed(), 56);
+}
+
+TEST(BitsReader, Wide)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+    bits::BitsReader reader(buffer);
+    uint8_t val1 = 0;
+    bits::uint<96> val2;
+    bits::uint<24> val3;
+
+    reader >> val1 >> val2;
+    reader.extract(val3, 20);
+
+    ASSERT_EQ(val1, 0x35);
+    ASSERT_EQ(val2, bits::uint<96>(0xFF7035FF, 0x7035FFCAFEBABEA5));
+    ASSERT_EQ(val3, bits::uint<24>(0xB6C7D));
+    ASSERT_EQ(reader.nbBitsStreamed(), 124);
+}
+
+TEST(BitsReader, View)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF);
+    bits::BitsReader reader(buffer);
+
+    ASSERT_EQ(reader.extract<uint8_t>(4), 0x03);
+    ASSERT_THROW(reader.view(1), std::out_of_range);
+
+    reader >> bits::align_to_byte();
+    const auto bytes = reader.view(2);
+    ASSERT_EQ(bytes.data(), buffer.data() + 1);
+    ASSERT_EQ(reader.extract<uint16_t>(12), 0x35F);
+    ASSERT_EQ(reader.nbBitsStreamed(), 36);
+}
+
+TEST(BitsReader, PeekAndSeek)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+    bits::BitsReader reader(buffer);
+
+    reader.skip(60);
+    ASSERT_EQ(reader.peek<uint16_t>(), 0xFCAF);
+    ASSERT_EQ(reader.nbBitsStreamed(), 60);
+
+    const auto mark = reader.mark();
+    ASSERT_EQ(reader.extract<uint64_t>(), 0xFCAFEBABEA5B6C7Du);
+    reader.rewind(mark);
+    ASSERT_EQ(reader.extract<uint16_t>(), 0xFCAF);
+
+    reader.seek(8);
+    ASSERT_EQ(reader.extract<uint8_t>(), 0xFF);
+    ASSERT_THROW(reader.seek(129), std::out_of_range);
+}
+
+//-----------------------------------------------------------------------------
+//- Chains of fields of every width (whole bytes for swapped bytes orders)
+//- should give the same values as the deserializer
+//-----------------------------------------------------------------------------
+template<bits::detail::bits_order Order>
+void checkSameAsDeserializer(void)
+{
+    std::array<std::byte, 97> buffer = {};
+    for(size_t i=0; i<buffer.size(); i++)
+        buffer[i] = std::byte((i * 0x9D + 0x35) ^ (i >> 2));
+
+    const size_t step = Order::swap_bytes ? 8 : 1;
+    bits::BasicBitsReader<Order> reader(buffer, 3);
+    bits::BasicBitsDeserializer<Order> deserializer(buffer, 3);
+
+    for(size_t nbBits=step; (reader.nbBitsStreamed() + 3 + nbBits + step) <= (buffer.size() * CHAR_BIT); nbBits = (nbBits % 64) + step)
+    {
+        ASSERT_EQ(reader.template extract<uint64_t>(nbBits), deserializer.template extract<uint64_t>(nbBits)) << "nbBits = " << nbBits;
+        ASSERT_EQ(reader.template extract<int64_t>(step), deserializer.template extract<int64_t>(step));
+    }
+}
+
+TEST(BitsReader, SameAsDeserializer)
+{
+    checkSameAsDeserializer<bits::MsbFirstBigEndian>();
+    checkSameAsDeserializer<bits::MsbFirstLittleEndian>();
+    checkSameAsDeserializer<bits::LsbFirstLittleEndian>();
+    checkSameAsDeserializer<bits::LsbFirstBigEndian>();
+}
@@ -13,33 +13,44 @@
 #include <span>
 
 #include <bits/bits_insertion.h>
+#include <bits/BitsOrder.h>
+#include <bits/BoundsCheck.h>
 #include <bits/detail/Traits.h>
 #include <bits/detail/BitsStream.h>
 
 namespace bits {
 
 //-----------------------------------------------------------------------------
-//- Bits serializer class
+//- Bits serializer class, with the bits order policy used for all insertions
 //-----------------------------------------------------------------------------
-class BitsSerializer : public detail::BitsStream<BitsSerializer>
+template<detail::bits_order Order, detail::bounds_check Bounds = DefaultBoundsCheck>
+class BasicBitsSerializer : public detail::BitsStream<BasicBitsSerializer<Order, Bounds>, Bounds>
 {
 public:
-    inline BitsSerializer(const std::span<std::byte> buffer, size_t initialOffsetBits = 0);
+    inline BasicBitsSerializer(const std::span<std::byte> buffer, size_t initialOffsetBits = 0);
 
     template<detail::input_basic_type T>
-    inline BitsSerializer & insert(T val, size_t nbBits = sizeof(T) * CHAR_BIT);
+    inline BasicBitsSerializer & insert(T val, size_t nbBits = sizeof(T) * CHAR_BIT);
     template<std::ranges::input_range R>
-    inline BitsSerializer & insert(R && r, size_t nbBits = sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
+    inline BasicBitsSerializer & insert(R && r, size_t nbBits = sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
 
 protected:
+    using Base = detail::BitsStream<BasicBitsSerializer<Order, Bounds>, Bounds>;
+    using Base::checkNbRemainingBits;
+    using Base::posBits;
+    using Base::nbBitsNext;
+
     const std::span<std::byte> buffer;
 };
 
-template<detail::input_basic_type T>
-inline BitsSerializer & operator <<(BitsSerializer & bs, T val);
-template<std::ranges::input_range R>
-inline BitsSerializer & operator <<(BitsSerializer & bs, R && r);
-inline BitsSerializer & operator <<(BitsSerializer & bs, const detail::BitsStreamManipulation manip);
+using BitsSerializer = BasicBitsSerializer<DefaultBitsOrder>;
+
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::input_basic_type T>
+inline BasicBitsSerializer<Order, Bounds> & operator <<(BasicBitsSerializer<Order, Bounds> & bs, T val);
+template<detail::bits_order Order, detail::bounds_check Bounds, std::ranges::input_range R>
+inline BasicBitsSerializer<Order, Bounds> & operator <<(BasicBitsSerializer<Order, Bounds> & bs, R && r);
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicBitsSerializer<Order, Bounds> & operator <<(BasicBitsSerializer<Order, Bounds> & bs, const detail::BitsStreamManipulation manip);
 
 
 
@@ -52,19 +63,22 @@ inline BitsSerializer & operator <<(BitsSerializer & bs, const detail::BitsStrea
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-BitsSerializer::BitsSerializer(const std::span<std::byte> buffer_, size_t initialOffsetBits)
-: BitsStream(buffer_.size() * CHAR_BIT, initialOffsetBits), buffer(buffer_)
+template<detail::bits_order Order, detail::bounds_check Bounds>
+BasicBitsSerializer<Order, Bounds>::BasicBitsSerializer(const std::span<std::byte> buffer_, size_t initialOffsetBits)
+: Base(buffer_.size() * CHAR_BIT, initialOffsetBits), buffer(buffer_)
 {}
 
 //-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
 template<detail::input_basic_type T>
-BitsSerializer & BitsSerializer::insert(T val, size_t nbBits)
+BasicBitsSerializer<Order, Bounds> & BasicBitsSerializer<Order, Bounds>::insert(T val, size_t nbBits)
 {
     auto nbBitsToInsert = nbBitsNext ? nbBitsNext : nbBits;
 
-    checkNbRemainingBits(nbBitsToInsert, "Unable to insert bits, too few bits remaining");
+    if(not checkNbRemainingBits(nbBitsToInsert, "Unable to insert bits, too few bits remaining"))
+        return *this;
 
-    bits::insert(buffer, val, posBits + nbBitsToInsert - 1, posBits);
+    bits::insert(Order{}, buffer, val, posBits + nbBitsToInsert - 1, posBits);
     posBits += nbBitsToInsert;
     nbBitsNext = 0;
 
@@ -72,14 +86,16 @@ BitsSerializer & BitsSerializer::insert(T val, size_t nbBits)
 }
 
 //-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
 template<std::ranges::input_range R>
-inline BitsSerializer & BitsSerializer::insert(R && r, size_t nbBits)
+inline BasicBitsSerializer<Order, Bounds> & BasicBitsSerializer<Order, Bounds>::insert(R && r, size_t nbBits)
 {
     auto nbBitsToInsertByElement = nbBitsNext ? nbBitsNext : nbBits;
     auto nbBitsToInsert = nbBitsToInsertByElement * detail::range_size(std::forward<R>(r));
-    checkNbRemainingBits(nbBitsToInsert, "Unable to insert bits, too few bits remaining");
+    if(not checkNbRemainingBits(nbBitsToInsert, "Unable to insert bits, too few bits remaining"))
+        return *this;
 
-    bits::insert(buffer, std::forward<R>(r), posBits + nbBitsToInsert - 1, posBits, nbBitsToInsertByElement);
+    bits::insert(Order{}, buffer, std::forward<R>(r), posBits + nbBitsToInsert - 1, posBits, nbBitsToInsertByElement);
     posBits += nbBitsToInsert;
     nbBitsNext = 0;
 
@@ -87,21 +103,22 @@ inline BitsSerializer & BitsSerializer::insert(R && r, size_t nbBits)
 }
 
 //-----------------------------------------------------------------------------
-template<detail::input_basic_type T>
-inline BitsSerializer & operator <<(BitsSerializer & bs, T val)
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::input_basic_type T>
+inline BasicBitsSerializer<Order, Bounds> & operator <<(BasicBitsSerializer<Order, Bounds> & bs, T val)
 {
     return bs.insert(val);
 }
 
 //-----------------------------------------------------------------------------
-template<std::ranges::input_range R>
-inline BitsSerializer & operator <<(BitsSerializer & bs, R && r)
+template<detail::bits_order Order, detail::bounds_check Bounds, std::ranges::input_range R>
+inline BasicBitsSerializer<Order, Bounds> & operator <<(BasicBitsSerializer<Order, Bounds> & bs, R && r)
 {
     return bs.insert(std::forward<R>(r), sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
 }
 
 //-----------------------------------------------------------------------------
-inline BitsSerializer & operator <<(BitsSerializer & bs, const detail::BitsStreamManipulation manip)
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicBitsSerializer<Order, Bounds> & operator <<(BasicBitsSerializer<Order, Bounds> & bs, const detail::BitsStreamManipulation manip)
 {
     bs.setManipulation(manip);
     return bs;
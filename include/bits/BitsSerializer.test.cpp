@@ -13,6 +13,7 @@
 #include <cstddef>
 
 #include <bits/BitsSerializer.h>
+#include <bits/Uint.h>
 
 using ::testing::ElementsAreArray;
 
@@ -67,6 +68,35 @@ TEST(BitsSerializer, OutOfRange)
     ASSERT_THROW(stream.skip(128), std::out_of_range);
 }
 
+TEST(BitsSerializer, BoundsCheck)
+{
+    std::array<std::byte, BUFFER_SIZE> buffer = {};
+    bits::BasicBitsSerializer<bits::MsbFirstBigEndian, bits::ExceptionBounds> checked(buffer);
+    bits::BasicBitsSerializer<bits::MsbFirstBigEndian, bits::UncheckedBounds> unchecked(buffer);
+
+    static_assert(std::is_same_v<bits::BitsSerializer, bits::BasicBitsSerializer<bits::DefaultBitsOrder, bits::DefaultBoundsCheck>>);
+    ASSERT_THROW(checked.skip(65), std::out_of_range);
+    ASSERT_NO_THROW(unchecked.skip(64));
+    ASSERT_EQ(unchecked.nbBitsStreamed(), 64);
+}
+
+TEST(BitsSerializer, BoundsCheck_Status)
+{
+    auto buffer = make_array(0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF);
+    bits::BasicBitsSerializer<bits::MsbFirstBigEndian, bits::StatusBounds> serializer(buffer);
+
+    serializer << uint16_t(0x1234) << uint64_t(0) << bits::nbits(4) << uint8_t(0x0);
+    ASSERT_TRUE(serializer.fail());
+    ASSERT_FALSE(serializer);
+    ASSERT_EQ(serializer.nbBitsStreamed(), 16);
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0x12, 0x34, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF)));
+
+    serializer.clear();
+    serializer << bits::nbits(4) << uint8_t(0x0);
+    ASSERT_TRUE(serializer.good());
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0x12, 0x34, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF)));
+}
+
 //-----------------------------------------------------------------------------
 //- BitsSerializer specific tests
 //-----------------------------------------------------------------------------
@@ -254,3 +284,27 @@ TEST(BitsSerializer, Ranges_nbits)
     serializer << bits::nbits(4) << c_array;
     ASSERT_THAT(buffer, ElementsAreArray(make_array(0xF5, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF)));
 }
+
+TEST(BitsSerializer, BitsOrder)
+{
+    auto buffer = make_array(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00);
+    bits::BasicBitsSerializer<bits::LsbFirstLittleEndian> serializer(buffer);
+
+    serializer.insert(uint8_t(0x05), 4).insert(uint8_t(0x03), 4);
+    serializer << uint16_t(0x70FF) << uint32_t(0x3570FF35);
+
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0x00)));
+    ASSERT_EQ(serializer.nbBitsStreamed(), 56);
+}
+
+TEST(BitsSerializer, Wide)
+{
+    std::array<std::byte, 16> buffer = {};
+    bits::BitsSerializer serializer(buffer);
+
+    serializer << uint8_t(0x35) << bits::uint<96>(0xFF7035FF, 0x7035FFCAFEBABEA5);
+    serializer.insert(bits::uint<24>(0xB6C7D), 20);
+
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD0)));
+    ASSERT_EQ(serializer.nbBitsStreamed(), 124);
+}
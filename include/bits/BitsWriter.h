@@ -0,0 +1,245 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_BITS_WRITER_H
+#define BITS_BITS_WRITER_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <climits>
+#include <span>
+
+#include <bits/bits_insertion.h>
+#include <bits/BitsOrder.h>
+#include <bits/BoundsCheck.h>
+#include <bits/detail/Traits.h>
+#include <bits/detail/BitsStream.h>
+#include <bits/detail/Serializer.h>
+#include <bits/detail/underlying_integral_type.h>
+#include <bits/detail/word_access.h>
+
+namespace bits {
+
+//-----------------------------------------------------------------------------
+//- Bits writer class : a bits serializer accumulating the inserted bits into
+//- a 64 bits register, written to the buffer a whole word at a time. So that
+//- a chain of small fields costs about one store per 8 bytes, instead of a
+//- read-modify-write of the buffer for each field.
+//-
+//- Pending bits are written to the buffer by 'flush()' (and on destruction),
+//- which should be called before reading the buffer. Skipping or resetting
+//- the stream flushes the pending bits on the next insertion. Wide fields and
+//- ranges are inserted directly into the buffer, after a flush.
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds = DefaultBoundsCheck>
+class BasicBitsWriter : public detail::BitsStream<BasicBitsWriter<Order, Bounds>, Bounds>
+{
+public:
+    inline BasicBitsWriter(const std::span<std::byte> buffer, size_t initialOffsetBits = 0);
+    inline ~BasicBitsWriter(void);
+
+    BasicBitsWriter(const BasicBitsWriter &) = delete;
+    BasicBitsWriter & operator =(const BasicBitsWriter &) = delete;
+
+    template<detail::input_basic_type T>
+    inline BasicBitsWriter & insert(T val, size_t nbBits = sizeof(T) * CHAR_BIT);
+    template<std::ranges::input_range R>
+    inline BasicBitsWriter & insert(R && r, size_t nbBits = sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
+
+    inline BasicBitsWriter & flush(void) noexcept;
+
+protected:
+    using Base = detail::BitsStream<BasicBitsWriter<Order, Bounds>, Bounds>;
+    using Base::checkNbRemainingBits;
+    using Base::posBits;
+    using Base::nbBitsNext;
+
+    inline void appendBits(detail::word_t val, size_t nbBits) noexcept;
+    inline void writeBits(void) noexcept;
+
+    const std::span<std::byte> buffer;
+
+    detail::word_t pending;
+    size_t pendingStart;
+    size_t nbPendingBits;
+};
+
+using BitsWriter = BasicBitsWriter<DefaultBitsOrder>;
+
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::input_basic_type T>
+inline BasicBitsWriter<Order, Bounds> & operator <<(BasicBitsWriter<Order, Bounds> & bs, T val);
+template<detail::bits_order Order, detail::bounds_check Bounds, std::ranges::input_range R>
+inline BasicBitsWriter<Order, Bounds> & operator <<(BasicBitsWriter<Order, Bounds> & bs, R && r);
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicBitsWriter<Order, Bounds> & operator <<(BasicBitsWriter<Order, Bounds> & bs, const detail::BitsStreamManipulation manip);
+
+
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicBitsWriter<Order, Bounds>::BasicBitsWriter(const std::span<std::byte> buffer_, size_t initialOffsetBits)
+: Base(buffer_.size() * CHAR_BIT, initialOffsetBits), buffer(buffer_), pending(0), pendingStart(initialOffsetBits), nbPendingBits(0)
+{}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicBitsWriter<Order, Bounds>::~BasicBitsWriter(void)
+{
+    flush();
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<detail::input_basic_type T>
+inline BasicBitsWriter<Order, Bounds> & BasicBitsWriter<Order, Bounds>::insert(T val, size_t nbBits)
+{
+    auto nbBitsToInsert = nbBitsNext ? nbBitsNext : nbBits;
+    if(not checkNbRemainingBits(nbBitsToInsert, "Unable to insert bits, too few bits remaining"))
+        return *this;
+
+    if constexpr(detail::IsWideInteger<T>::value)
+    {
+        flush();
+        bits::insert(Order{}, buffer, val, posBits + nbBitsToInsert - 1, posBits);
+    }
+    else if(nbBitsToInsert > 0)
+    {
+        auto rawVal = static_cast<detail::word_t>(static_cast<detail::underlying_integral_type_t<T>>(val)) & detail::mask_64bits(nbBitsToInsert);
+
+        if constexpr(Order::swap_bytes)
+            rawVal = detail::swap_value_bytes(rawVal, nbBitsToInsert);
+
+        if(posBits != (pendingStart + nbPendingBits))
+            flush();
+
+        appendBits(rawVal, nbBitsToInsert);
+    }
+
+    posBits += nbBitsToInsert;
+    nbBitsNext = 0;
+
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<std::ranges::input_range R>
+inline BasicBitsWriter<Order, Bounds> & BasicBitsWriter<Order, Bounds>::insert(R && r, size_t nbBits)
+{
+    auto nbBitsToInsertByElement = nbBitsNext ? nbBitsNext : nbBits;
+    auto nbBitsToInsert = nbBitsToInsertByElement * detail::range_size(std::forward<R>(r));
+    if(not checkNbRemainingBits(nbBitsToInsert, "Unable to insert bits, too few bits remaining"))
+        return *this;
+
+    flush();
+    bits::insert(Order{}, buffer, std::forward<R>(r), posBits + nbBitsToInsert - 1, posBits, nbBitsToInsertByElement);
+    posBits += nbBitsToInsert;
+    nbBitsNext = 0;
+
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicBitsWriter<Order, Bounds> & BasicBitsWriter<Order, Bounds>::flush(void) noexcept
+{
+    if(nbPendingBits > 0)
+        writeBits();
+
+    pending       = 0;
+    pendingStart  = posBits;
+    nbPendingBits = 0;
+
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+//- Pending bits are right aligned into the register. With MSB first
+//- numbering, the first bits are the most significant ones, and the least
+//- significant ones with LSB first numbering. When the register is full,
+//- it is written to the buffer and the remaining bits of the value start a
+//- new register.
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline void BasicBitsWriter<Order, Bounds>::appendBits(detail::word_t val, size_t nbBits) noexcept
+{
+    const auto nbFreeBits = detail::WORD_BITS - nbPendingBits;
+    const auto nbFirstBits = (nbBits < nbFreeBits) ? nbBits : nbFreeBits;
+    const auto nbLastBits  = nbBits - nbFirstBits;
+
+    if constexpr(Order::bit_order == BitOrder::LSB_FIRST)
+        pending |= (val & detail::mask_64bits(nbFirstBits)) << nbPendingBits;
+    else
+        pending = (nbFirstBits < detail::WORD_BITS ? (pending << nbFirstBits) : 0) | (val >> nbLastBits);
+    nbPendingBits += nbFirstBits;
+
+    if(nbPendingBits < detail::WORD_BITS)
+        return;
+
+    writeBits();
+    pendingStart += detail::WORD_BITS;
+    nbPendingBits = nbLastBits;
+
+    if constexpr(Order::bit_order == BitOrder::LSB_FIRST)
+        pending = nbLastBits ? (val >> nbFirstBits) : 0;
+    else
+        pending = val & detail::mask_64bits(nbLastBits);
+}
+
+//-----------------------------------------------------------------------------
+//- Pending bits are written with the natural bytes order of the bits
+//- numbering (bytes of the fields being already swapped), with a single
+//- store for a whole byte aligned word
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline void BasicBitsWriter<Order, Bounds>::writeBits(void) noexcept
+{
+    using NaturalOrder = BitsOrder<Order::bit_order, Order::natural_byte_order>;
+
+    const auto index = pendingStart / CHAR_BIT;
+
+    if(nbPendingBits == detail::WORD_BITS and (pendingStart % CHAR_BIT) == 0 and (index + detail::WORD_BYTES) <= buffer.size())
+        detail::store<detail::WORD_BYTES, Order::natural_byte_order>(buffer, index, pending);
+    else
+    {
+        const detail::Serializer<NaturalOrder> serializer(pendingStart + nbPendingBits - 1, pendingStart);
+        serializer.insert(pending, buffer);
+    }
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::input_basic_type T>
+inline BasicBitsWriter<Order, Bounds> & operator <<(BasicBitsWriter<Order, Bounds> & bs, T val)
+{
+    return bs.insert(val);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds, std::ranges::input_range R>
+inline BasicBitsWriter<Order, Bounds> & operator <<(BasicBitsWriter<Order, Bounds> & bs, R && r)
+{
+    return bs.insert(std::forward<R>(r), sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicBitsWriter<Order, Bounds> & operator <<(BasicBitsWriter<Order, Bounds> & bs, const detail::BitsStreamManipulation manip)
+{
+    bs.setManipulation(manip);
+    return bs;
+}
+
+} // namespace bits
+
+#endif /* BITS_BITS_WRITER_H */
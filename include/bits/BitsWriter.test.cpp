@@ -0,0 +1,237 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <array>
+#include <span>
+#include <vector>
+#include <cstddef>
+
+#include <bits/BitsWriter.h>
+#include <bits/BitsSerializer.h>
+#include <bits/Uint.h>
+
+using ::testing::ElementsAreArray;
+
+template<typename T = std::byte, typename... Ts>
+constexpr std::array<T, sizeof...(Ts)> make_array(Ts && ... args) noexcept
+{
+    return { T(std::forward<Ts>(args))... };
+}
+
+const size_t BUFFER_SIZE = 8;
+
+//-----------------------------------------------------------------------------
+//- Writer / Serializer common tests
+//-----------------------------------------------------------------------------
+TEST(BitsWriter, OutOfRange)
+{
+    std::array<std::byte, BUFFER_SIZE> buffer = {};
+    bits::BitsWriter writer(buffer);
+
+    ASSERT_THROW(writer.skip(128), std::out_of_range);
+    ASSERT_THROW(writer.insert(uint8_t(0), 65), std::out_of_range);
+}
+
+TEST(BitsWriter, NbBitsWritten)
+{
+    std::array<std::byte, BUFFER_SIZE> buffer = {};
+    bits::BitsWriter writer(buffer);
+
+    ASSERT_EQ(writer.nbBitsStreamed(), 0);
+    writer.insert<uint8_t>(0x0, 4); ASSERT_EQ(writer.nbBitsStreamed(), 4);
+    writer.insert<uint8_t>(0x0, 2); ASSERT_EQ(writer.nbBitsStreamed(), 6);
+    writer.insert<uint8_t>(0x0, 8); ASSERT_EQ(writer.nbBitsStreamed(), 14);
+    writer.insert<uint8_t>(0x0, 8); ASSERT_EQ(writer.nbBitsStreamed(), 22);
+    writer.insert<uint8_t>(0x0, 8); ASSERT_EQ(writer.nbBitsStreamed(), 30);
+}
+
+TEST(BitsWriter, ChainedInsert)
+{
+    std::array<std::byte, BUFFER_SIZE> buffer = {};
+    bits::BitsWriter writer(buffer);
+
+    writer
+        .insert(uint8_t { 0x03 }, 4)
+        .insert(uint8_t { 0x01 }, 2)
+        .insert(uint8_t { 0x7F }, 8)
+        .insert(uint8_t { 0xDC }, 8)
+        .insert(uint8_t { 0x0D }, 8)
+        .flush()
+    ;
+
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0x35, 0xFF, 0x70, 0x34, 0x00, 0x00, 0x00, 0x00)));
+}
+
+TEST(BitsWriter, ChainedInsert_Operator)
+{
+    std::array<std::byte, BUFFER_SIZE * 2> buffer = {};
+    bits::BitsWriter writer(buffer);
+
+    writer
+        << uint8_t  { 0xD8 }
+        << uint8_t  { 0xE9 }
+        << uint16_t { 0xA5A5 }
+        << uint32_t { 0xB6B6'B6B6 }
+        << uint64_t { 0xC7C7'C7C7'C7C7'C7C7 }
+    ;
+    writer.flush();
+
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0xD8, 0xE9, 0xA5, 0xA5, 0xB6, 0xB6, 0xB6, 0xB6, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7)));
+}
+
+TEST(BitsWriter, BitsManipulation_SkipAndReset)
+{
+    auto buffer = make_array(0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF);
+    bits::BitsWriter writer(buffer, 4);
+
+    writer << bits::nbits(4) << uint8_t(0x0) << bits::skip(8) << bits::nbits(4) << uint8_t(0x0);
+    writer << bits::reset() << bits::skip(24) << uint16_t(0x1234);
+    ASSERT_EQ(writer.nbBitsStreamed(), 40);
+
+    writer.flush();
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0xF0, 0xFF, 0x0F, 0xF1, 0x23, 0x4F, 0xFF, 0xFF)));
+}
+
+//-----------------------------------------------------------------------------
+//- BitsWriter specific tests
+//-----------------------------------------------------------------------------
+TEST(BitsWriter, Flush)
+{
+    auto buffer = make_array(0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF);
+    bits::BitsWriter writer(buffer, 4);
+
+    writer << bits::nbits(2) << uint8_t(0x0) << bits::nbits(2) << uint8_t(0x1) << uint64_t(0x0123'4567'89AB'CDEF);
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0xF1, 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0xFF)));
+
+    writer.flush();
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0xF1, 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0xFF)));
+
+    writer << bits::nbits(4) << uint8_t(0x0);
+    writer.flush();
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0xF1, 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0x0F)));
+}
+
+TEST(BitsWriter, Flush_OnDestruction)
+{
+    std::array<std::byte, BUFFER_SIZE> buffer = {};
+
+    {
+        bits::BitsWriter writer(buffer);
+        writer << bits::nbits(2) << uint8_t(0x2) << bits::nbits(2) << uint8_t(0x1) << bits::nbits(4) << uint8_t(0xC) << uint8_t(0x5A);
+        ASSERT_THAT(buffer, ElementsAreArray(make_array(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)));
+    }
+
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0x9C, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)));
+}
+
+TEST(BitsWriter, MarkAndRewind)
+{
+    auto buffer = make_array(0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF);
+    bits::BitsWriter writer(buffer);
+
+    writer << uint8_t(0x12);
+    const auto mark = writer.mark();
+    writer << uint16_t(0x3456);
+    writer.rewind(mark);
+    writer << uint8_t(0xAB);
+    writer.seek(40) << uint8_t(0xCD);
+    ASSERT_EQ(writer.nbBitsStreamed(), 48);
+
+    writer.flush();
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0x12, 0xAB, 0x56, 0xFF, 0xFF, 0xCD, 0xFF, 0xFF)));
+}
+
+TEST(BitsWriter, Signed)
+{
+    std::array<std::byte, BUFFER_SIZE> buffer = {};
+    bits::BitsWriter writer(buffer);
+
+    writer.insert(int8_t(-1), 4).insert(int16_t(-9), 12).insert(int32_t(-2), 8).flush();
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0xFF, 0xF7, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00)));
+}
+
+TEST(BitsWriter, Buffer_tail)
+{
+    auto buffer = make_array(0xFF, 0xFF, 0xFF, 0xFF, 0xFF);
+    bits::BitsWriter writer(buffer);
+
+    writer.insert(uint16_t(0x35F), 12).insert(uint16_t(0xF70), 12).insert(uint16_t(0x35), 12).flush();
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0x35, 0xFF, 0x70, 0x03, 0x5F)));
+}
+
+TEST(BitsWriter, Ranges)
+{
+    auto buffer = make_array(0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF);
+    bits::BitsWriter writer(buffer);
+    std::array<uint8_t, 3> array = { 0x5F, 0xF7, 0x03 };
+
+    writer << bits::nbits(4) << uint8_t(0x0) << array << bits::nbits(4) << uint8_t(0x0);
+    writer.flush();
+
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0x05, 0xFF, 0x70, 0x30, 0xFF, 0xFF, 0xFF, 0xFF)));
+}
+
+TEST(BitsWriter, BitsOrder)
+{
+    auto buffer = make_array(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00);
+    bits::BasicBitsWriter<bits::LsbFirstLittleEndian> writer(buffer);
+
+    writer.insert(uint8_t(0x05), 4).insert(uint8_t(0x03), 4);
+    writer << uint16_t(0x70FF) << uint32_t(0x3570FF35);
+    writer.flush();
+
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0x00)));
+    ASSERT_EQ(writer.nbBitsStreamed(), 56);
+}
+
+TEST(BitsWriter, Wide)
+{
+    std::array<std::byte, 16> buffer = {};
+    bits::BitsWriter writer(buffer);
+
+    writer << uint8_t(0x35) << bits::uint<96>(0xFF7035FF, 0x7035FFCAFEBABEA5);
+    writer.insert(bits::uint<24>(0xB6C7D), 20).flush();
+
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD0)));
+    ASSERT_EQ(writer.nbBitsStreamed(), 124);
+}
+
+//-----------------------------------------------------------------------------
+//- Chains of fields of every width (whole bytes for swapped bytes orders)
+//- should give the same buffer as the serializer
+//-----------------------------------------------------------------------------
+template<bits::detail::bits_order Order>
+void checkSameAsSerializer(void)
+{
+    std::array<std::byte, 97> writerBuffer = {};
+    std::array<std::byte, 97> serializerBuffer = {};
+    writerBuffer.fill(std::byte(0xA5));
+    serializerBuffer.fill(std::byte(0xA5));
+
+    const size_t step = Order::swap_bytes ? 8 : 1;
+    bits::BasicBitsWriter<Order> writer(writerBuffer, 3);
+    bits::BasicBitsSerializer<Order> serializer(serializerBuffer, 3);
+
+    for(size_t nbBits=step, i=0; (writer.nbBitsStreamed() + 3 + nbBits + step) <= (writerBuffer.size() * CHAR_BIT); nbBits = (nbBits % 64) + step, i++)
+    {
+        const uint64_t val = 0x9E37'79B9'7F4A'7C15u * (i + 1);
+        writer.insert(val, nbBits).insert(int64_t(-1), step);
+        serializer.insert(val, nbBits).insert(int64_t(-1), step);
+    }
+
+    writer.flush();
+    ASSERT_THAT(writerBuffer, ElementsAreArray(serializerBuffer));
+}
+
+TEST(BitsWriter, SameAsSerializer)
+{
+    checkSameAsSerializer<bits::MsbFirstBigEndian>();
+    checkSameAsSerializer<bits::MsbFirstLittleEndian>();
+    checkSameAsSerializer<bits::LsbFirstLittleEndian>();
+    checkSameAsSerializer<bits::LsbFirstBigEndian>();
+}
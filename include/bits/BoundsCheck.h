@@ -0,0 +1,122 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_BOUNDS_CHECK_H
+#define BITS_BOUNDS_CHECK_H
+
+#include <cassert>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+//-----------------------------------------------------------------------------
+//- Default bounds check of bits streams, selected by the 'BITS_BOUNDS_CHECK'
+//- macro (set by the 'BITS_BOUNDS_CHECK' CMake option) :
+//-     - BITS_BOUNDS_CHECK_NONE
+//-     - BITS_BOUNDS_CHECK_ASSERT
+//-     - BITS_BOUNDS_CHECK_EXCEPTION (default)
+//-     - BITS_BOUNDS_CHECK_STATUS
+//-----------------------------------------------------------------------------
+#define BITS_BOUNDS_CHECK_NONE      0
+#define BITS_BOUNDS_CHECK_ASSERT    1
+#define BITS_BOUNDS_CHECK_EXCEPTION 2
+#define BITS_BOUNDS_CHECK_STATUS    3
+
+#ifndef BITS_BOUNDS_CHECK
+#define BITS_BOUNDS_CHECK BITS_BOUNDS_CHECK_EXCEPTION
+#endif
+
+namespace bits {
+
+//-----------------------------------------------------------------------------
+//- Bounds check of bits streams insertions / extractions :
+//-     - NONE : no check at all, for buffers whose length is validated
+//-       beforehand (zero cost)
+//-     - ASSERT : checked by assert() (debug builds only)
+//-     - EXCEPTION : std::out_of_range is thrown
+//-     - STATUS : a sticky fail flag of the stream is set (as the failbit of
+//-       iostreams), and the following insertions / extractions are ignored
+//-       until the flag is cleared. Never throws nor allocates, so that
+//-       malformed inputs are handled by a single check per message.
+//-----------------------------------------------------------------------------
+enum class BoundsCheck
+{
+    NONE,
+    ASSERT,
+    EXCEPTION,
+    STATUS,
+};
+
+//-----------------------------------------------------------------------------
+//- Bounds check policy : 'check()' tells if the insertion / extraction is to
+//- be done
+//-----------------------------------------------------------------------------
+template<BoundsCheck boundsCheck>
+struct BoundsCheckPolicy
+{
+    static constexpr BoundsCheck bounds_check = boundsCheck;
+
+    static inline bool check(bool inBounds, std::string_view message);
+};
+
+using UncheckedBounds = BoundsCheckPolicy<BoundsCheck::NONE>;
+using AssertBounds    = BoundsCheckPolicy<BoundsCheck::ASSERT>;
+using ExceptionBounds = BoundsCheckPolicy<BoundsCheck::EXCEPTION>;
+using StatusBounds    = BoundsCheckPolicy<BoundsCheck::STATUS>;
+
+#if BITS_BOUNDS_CHECK == BITS_BOUNDS_CHECK_NONE
+using DefaultBoundsCheck = UncheckedBounds;
+#elif BITS_BOUNDS_CHECK == BITS_BOUNDS_CHECK_ASSERT
+using DefaultBoundsCheck = AssertBounds;
+#elif BITS_BOUNDS_CHECK == BITS_BOUNDS_CHECK_STATUS
+using DefaultBoundsCheck = StatusBounds;
+#else
+using DefaultBoundsCheck = ExceptionBounds;
+#endif
+
+namespace detail {
+
+//-----------------------------------------------------------------------------
+//- Trait and concept to check if a type is a bounds check policy
+//-----------------------------------------------------------------------------
+template<typename T>                struct is_bounds_check : std::false_type {};
+template<BoundsCheck boundsCheck>   struct is_bounds_check<BoundsCheckPolicy<boundsCheck>> : std::true_type {};
+
+template<typename T> inline constexpr bool is_bounds_check_v = is_bounds_check<std::remove_cvref_t<T>>::value;
+
+template<typename T>
+concept bounds_check = is_bounds_check_v<T>;
+
+} // namespace detail
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<BoundsCheck boundsCheck>
+bool BoundsCheckPolicy<boundsCheck>::check([[maybe_unused]] bool inBounds, [[maybe_unused]] std::string_view message)
+{
+    if constexpr(boundsCheck == BoundsCheck::ASSERT)
+        assert(inBounds and "Bits stream out of bounds");
+    else if constexpr(boundsCheck == BoundsCheck::EXCEPTION)
+    {
+        if(not inBounds)
+            throw std::out_of_range(message.data());
+    }
+    else if constexpr(boundsCheck == BoundsCheck::STATUS)
+        return inBounds;
+
+    return true;
+}
+
+} // namespace bits
+
+#endif /* BITS_BOUNDS_CHECK_H */
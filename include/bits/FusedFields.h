@@ -0,0 +1,234 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_FUSED_FIELDS_H
+#define BITS_FUSED_FIELDS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <climits>
+#include <array>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+#include <bits/BitsOrder.h>
+#include <bits/detail/word_access.h>
+
+namespace bits {
+
+namespace detail {
+
+//-----------------------------------------------------------------------------
+//- Group of consecutive fields with compile time widths, streamed at once
+//- (see 'fused()' below)
+//-----------------------------------------------------------------------------
+template<typename NbBits, typename... T>
+struct FusedFields;
+
+template<size_t... nbBits, typename... T>
+struct FusedFields<std::index_sequence<nbBits...>, T...>
+{
+    static_assert(sizeof...(nbBits) == sizeof...(T), "One width is expected by field");
+    static_assert(((nbBits > 0) and ...), "Fused fields should not be empty");
+    static_assert(((nbBits <= sizeof(std::remove_cvref_t<T>) * CHAR_BIT) and ...), "Fused field wider than its type");
+    static_assert(((std::is_integral_v<std::remove_cvref_t<T>> or std::is_enum_v<std::remove_cvref_t<T>>) and ...), "Fused fields should be integers or enumerations");
+    static_assert((nbBits + ...) <= WORD_BITS, "Fused fields should fit into a 64 bits word");
+
+    static constexpr size_t nb_bits = (nbBits + ...);
+    static constexpr std::array<size_t, sizeof...(nbBits)> nb_bits_by_field = { nbBits... };
+
+    std::tuple<T &&...> fields;
+};
+
+//-----------------------------------------------------------------------------
+//- Bits order policy of a bits stream (its first template parameter)
+//-----------------------------------------------------------------------------
+template<typename Stream>
+struct stream_bits_order;
+
+template<template<typename, typename...> class Stream, typename Order, typename... Ts>
+struct stream_bits_order<Stream<Order, Ts...>> { using type = Order; };
+
+template<typename Stream>
+using stream_bits_order_t = typename stream_bits_order<std::remove_cvref_t<Stream>>::type;
+
+//-----------------------------------------------------------------------------
+//- Concepts for bits streams extracting / inserting a word at once
+//-----------------------------------------------------------------------------
+template<typename Stream>
+concept word_extracting_stream = requires(Stream & bs) { bs.template extract<word_t>(size_t(0)); };
+template<typename Stream>
+concept word_inserting_stream = requires(Stream & bs) { bs.insert(word_t(0), size_t(0)); };
+
+//-----------------------------------------------------------------------------
+//- Split a fused word into its fields / pack the fields into a fused word
+//-----------------------------------------------------------------------------
+template<bits_order Order, typename Fused>
+inline constexpr size_t fused_shift(size_t index) noexcept;
+template<bits_order Order, size_t... nbBits, typename... T>
+inline constexpr void split_fused(word_t word, FusedFields<std::index_sequence<nbBits...>, T...> & fused) noexcept;
+template<bits_order Order, size_t... nbBits, typename... T>
+inline constexpr word_t pack_fused(const FusedFields<std::index_sequence<nbBits...>, T...> & fused) noexcept;
+
+} // namespace detail
+
+//-----------------------------------------------------------------------------
+//- Fused fields : consecutive fields with compile time widths (up to 64 bits
+//- in total), streamed as a single word.
+//-
+//- A chain such as 'deserializer >> nbits(4) >> a >> nbits(4) >> b' runs a
+//- bounds check, a position update and an extraction kernel for each field.
+//- Fused, the group is bounds checked and extracted (or inserted) once, and
+//- the fields are split from (or packed into) the word with constant shifts
+//- and masks :
+//-     deserializer >> bits::fused<4, 4, 8>(a, b, c);
+//-     serializer   << bits::fused<4, 4, 8>(a, b, c);
+//-
+//- Fields are integers or enumerations, signed fields being sign extended.
+//- With the bits orders swapping bytes, fields should be whole bytes.
+//-----------------------------------------------------------------------------
+template<size_t... nbBits, typename... T>
+inline constexpr detail::FusedFields<std::index_sequence<nbBits...>, T...> fused(T && ... fields) noexcept;
+
+template<detail::word_extracting_stream Stream, size_t... nbBits, typename... T>
+inline Stream & operator >>(Stream & bs, detail::FusedFields<std::index_sequence<nbBits...>, T...> && fused);
+template<detail::word_inserting_stream Stream, size_t... nbBits, typename... T>
+inline Stream & operator <<(Stream & bs, detail::FusedFields<std::index_sequence<nbBits...>, T...> && fused);
+
+
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<size_t... nbBits, typename... T>
+inline constexpr detail::FusedFields<std::index_sequence<nbBits...>, T...> fused(T && ... fields) noexcept
+{
+    return { std::forward_as_tuple(std::forward<T>(fields)...) };
+}
+
+//-----------------------------------------------------------------------------
+//- Bounds checked and extracted once (the fields being left untouched when
+//- the stream has failed)
+//-----------------------------------------------------------------------------
+template<detail::word_extracting_stream Stream, size_t... nbBits, typename... T>
+inline Stream & operator >>(Stream & bs, detail::FusedFields<std::index_sequence<nbBits...>, T...> && fused)
+{
+    using Fused = detail::FusedFields<std::index_sequence<nbBits...>, T...>;
+    static_assert(((not std::is_const_v<std::remove_reference_t<T>>) and ...), "Unable to extract into constant fields");
+
+    const auto word = bs.template extract<detail::word_t>(Fused::nb_bits);
+    if(bs)
+        detail::split_fused<detail::stream_bits_order_t<Stream>>(word, fused);
+
+    return bs;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::word_inserting_stream Stream, size_t... nbBits, typename... T>
+inline Stream & operator <<(Stream & bs, detail::FusedFields<std::index_sequence<nbBits...>, T...> && fused)
+{
+    using Fused = detail::FusedFields<std::index_sequence<nbBits...>, T...>;
+
+    return bs.insert(detail::pack_fused<detail::stream_bits_order_t<Stream>>(fused), Fused::nb_bits);
+}
+
+namespace detail {
+
+//-----------------------------------------------------------------------------
+//- Shift of a field inside the fused word : with MSB first numbering, the
+//- first field is the most significant bits of the word, and with LSB first
+//- numbering its least significant bits
+//-----------------------------------------------------------------------------
+template<bits_order Order, typename Fused>
+inline constexpr size_t fused_shift(size_t index) noexcept
+{
+    size_t nbBitsBefore = 0;
+    for(size_t i=0; i<index; i++)
+        nbBitsBefore += Fused::nb_bits_by_field[i];
+
+    if constexpr(Order::bit_order == BitOrder::MSB_FIRST)
+        return Fused::nb_bits - nbBitsBefore - Fused::nb_bits_by_field[index];
+    else
+        return nbBitsBefore;
+}
+
+//-----------------------------------------------------------------------------
+//- The word is the value of the whole group, read with the bits order.
+//- Swapping bytes applies to each field, so the group bytes are swapped back
+//- first (and swapped again after packing).
+//-----------------------------------------------------------------------------
+template<bits_order Order, size_t... nbBits, typename... T>
+inline constexpr void split_fused(word_t word, FusedFields<std::index_sequence<nbBits...>, T...> & fused) noexcept
+{
+    using Fused = FusedFields<std::index_sequence<nbBits...>, T...>;
+
+    if constexpr(Order::swap_bytes)
+    {
+        static_assert(((nbBits % CHAR_BIT == 0) and ...), "Fused fields should be whole bytes with this bits order");
+        word = swap_value_bytes(word, Fused::nb_bits);
+    }
+
+    [&]<size_t... I>(std::index_sequence<I...>)
+    {
+        ([&]
+        {
+            using Field = std::remove_cvref_t<std::tuple_element_t<I, std::tuple<T...>>>;
+            using Raw   = typename std::conditional_t<std::is_enum_v<Field>, std::underlying_type<Field>, std::type_identity<Field>>::type;
+            constexpr size_t fieldBits = Fused::nb_bits_by_field[I];
+
+            auto val = (word >> fused_shift<Order, Fused>(I)) & mask_64bits(fieldBits);
+            if constexpr(Order::swap_bytes)
+                val = swap_value_bytes(val, fieldBits);
+            if constexpr(std::is_signed_v<Raw>)
+                val = static_cast<word_t>(static_cast<int64_t>(val << (WORD_BITS - fieldBits)) >> (WORD_BITS - fieldBits));
+
+            std::get<I>(fused.fields) = static_cast<Field>(static_cast<Raw>(val));
+        }(), ...);
+    }(std::index_sequence_for<T...>{});
+}
+
+//-----------------------------------------------------------------------------
+template<bits_order Order, size_t... nbBits, typename... T>
+inline constexpr word_t pack_fused(const FusedFields<std::index_sequence<nbBits...>, T...> & fused) noexcept
+{
+    using Fused = FusedFields<std::index_sequence<nbBits...>, T...>;
+    word_t word = 0;
+
+    if constexpr(Order::swap_bytes)
+        static_assert(((nbBits % CHAR_BIT == 0) and ...), "Fused fields should be whole bytes with this bits order");
+
+    [&]<size_t... I>(std::index_sequence<I...>)
+    {
+        ([&]
+        {
+            constexpr size_t fieldBits = Fused::nb_bits_by_field[I];
+
+            auto val = static_cast<word_t>(std::get<I>(fused.fields)) & mask_64bits(fieldBits);
+            if constexpr(Order::swap_bytes)
+                val = swap_value_bytes(val, fieldBits);
+
+            word |= val << fused_shift<Order, Fused>(I);
+        }(), ...);
+    }(std::index_sequence_for<T...>{});
+
+    if constexpr(Order::swap_bytes)
+        word = swap_value_bytes(word, Fused::nb_bits);
+
+    return word;
+}
+
+} // namespace detail
+
+} // namespace bits
+
+#endif /* BITS_FUSED_FIELDS_H */
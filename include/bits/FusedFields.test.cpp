@@ -0,0 +1,205 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <array>
+#include <span>
+#include <vector>
+#include <cstddef>
+
+#include <bits/FusedFields.h>
+#include <bits/BitsSerializer.h>
+#include <bits/BitsDeserializer.h>
+#include <bits/BitsReader.h>
+#include <bits/BitsWriter.h>
+#include <bits/GrowableBitsSerializer.h>
+#include <bits/ScatterBitsDeserializer.h>
+
+using ::testing::ElementsAreArray;
+
+template<typename T = std::byte, typename... Ts>
+constexpr std::array<T, sizeof...(Ts)> make_array(Ts && ... args) noexcept
+{
+    return { T(std::forward<Ts>(args))... };
+}
+
+const auto BUFFER = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+enum class Kind : uint8_t { A = 0x0A, F = 0x0F };
+
+//-----------------------------------------------------------------------------
+//- Fused extractions
+//-----------------------------------------------------------------------------
+TEST(FusedFields, Extract)
+{
+    bits::BitsDeserializer deserializer(BUFFER);
+    uint8_t version = 0;
+    uint8_t ihl = 0;
+    uint8_t tos = 0;
+    uint16_t length = 0;
+    uint32_t next = 0;
+
+    deserializer >> bits::fused<4, 4, 8, 16>(version, ihl, tos, length) >> bits::fused<12>(next);
+
+    ASSERT_EQ(version, 0x03);
+    ASSERT_EQ(ihl, 0x05);
+    ASSERT_EQ(tos, 0xFF);
+    ASSERT_EQ(length, 0x7035);
+    ASSERT_EQ(next, 0xFF7u);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 44);
+}
+
+TEST(FusedFields, Extract_SignedAndEnum)
+{
+    bits::BitsDeserializer deserializer(BUFFER, 4);
+    int8_t val1 = 0;
+    Kind kind = Kind::A;
+    int16_t val2 = 0;
+    bool flag = false;
+
+    deserializer >> bits::fused<4, 4, 12, 1>(val1, kind, val2, flag);
+
+    ASSERT_EQ(val1, 5);
+    ASSERT_EQ(kind, Kind::F);
+    ASSERT_EQ(val2, -144);
+    ASSERT_EQ(flag, false);
+}
+
+TEST(FusedFields, Extract_WholeWord)
+{
+    bits::BitsDeserializer deserializer(BUFFER, 8);
+    uint64_t val = 0;
+
+    deserializer >> bits::fused<64>(val);
+
+    ASSERT_EQ(val, 0xFF7035FF'7035FFCAu);
+}
+
+TEST(FusedFields, Extract_OutOfRange)
+{
+    bits::BitsDeserializer deserializer(BUFFER, 100);
+    uint16_t val1 = 0x1234;
+    uint16_t val2 = 0x5678;
+
+    ASSERT_THROW((deserializer >> bits::fused<16, 16>(val1, val2)), std::out_of_range);
+    ASSERT_EQ(val1, 0x1234);
+    ASSERT_EQ(val2, 0x5678);
+}
+
+TEST(FusedFields, Extract_Status)
+{
+    bits::BasicBitsDeserializer<bits::MsbFirstBigEndian, bits::StatusBounds> deserializer(BUFFER, 100);
+    uint16_t val1 = 0x1234;
+    uint16_t val2 = 0x5678;
+
+    deserializer >> bits::fused<16, 16>(val1, val2);
+
+    ASSERT_TRUE(deserializer.fail());
+    ASSERT_EQ(val1, 0x1234);
+    ASSERT_EQ(val2, 0x5678);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 0);
+}
+
+TEST(FusedFields, Extract_OtherStreams)
+{
+    const std::array<std::span<const std::byte>, 2> chunks = { std::span(BUFFER).first(1), std::span(BUFFER).subspan(1) };
+    bits::BitsReader reader(BUFFER);
+    bits::ScatterBitsDeserializer scatter(chunks);
+    uint8_t val1 = 0;
+    uint8_t val2 = 0;
+    uint16_t val3 = 0;
+
+    reader >> bits::fused<4, 8, 12>(val1, val2, val3);
+    ASSERT_EQ(val1, 0x03);
+    ASSERT_EQ(val2, 0x5F);
+    ASSERT_EQ(val3, 0xF70);
+
+    scatter >> bits::fused<4, 8, 12>(val1, val2, val3);
+    ASSERT_EQ(val1, 0x03);
+    ASSERT_EQ(val2, 0x5F);
+    ASSERT_EQ(val3, 0xF70);
+}
+
+//-----------------------------------------------------------------------------
+//- Fused insertions
+//-----------------------------------------------------------------------------
+TEST(FusedFields, Insert)
+{
+    std::array<std::byte, 8> buffer = {};
+    bits::BitsSerializer serializer(buffer);
+    const uint8_t version = 0x04;
+
+    serializer << bits::fused<4, 4, 8, 16>(version, 5, uint8_t(0xFF), 0x7035) << bits::fused<4, 4>(int8_t(-1), Kind::A);
+
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0x45, 0xFF, 0x70, 0x35, 0xFA, 0x00, 0x00, 0x00)));
+    ASSERT_EQ(serializer.nbBitsStreamed(), 40);
+}
+
+TEST(FusedFields, Insert_OtherStreams)
+{
+    std::array<std::byte, 4> buffer = {};
+    {
+        bits::BitsWriter writer(buffer);
+        writer << bits::fused<4, 8, 12>(0x3, 0x5F, 0xF70);
+    }
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0x35, 0xFF, 0x70, 0x00)));
+
+    bits::GrowableBitsSerializer growable;
+    growable << bits::fused<4, 8, 12>(0x3, 0x5F, 0xF70);
+    ASSERT_THAT(growable.bytes(), ElementsAreArray(make_array(0x35, 0xFF, 0x70)));
+}
+
+//-----------------------------------------------------------------------------
+//- Fused fields should give the same values as the chained fields, for every
+//- bits order
+//-----------------------------------------------------------------------------
+template<bits::detail::bits_order Order>
+void checkSameAsChained(void)
+{
+    constexpr bool wholeBytes = Order::swap_bytes;
+    constexpr size_t nbBits1 = wholeBytes ? 8 : 3;
+    constexpr size_t nbBits2 = wholeBytes ? 16 : 13;
+    constexpr size_t nbBits3 = wholeBytes ? 24 : 29;
+    constexpr size_t nbBits4 = wholeBytes ? 8 : 11;
+
+    for(size_t offset=0; offset<=(BUFFER.size() * CHAR_BIT - 56); offset++)
+    {
+        bits::BasicBitsDeserializer<Order> chained(BUFFER, offset);
+        bits::BasicBitsDeserializer<Order> fused(BUFFER, offset);
+        uint8_t  val1 = 0, fused1 = 0;
+        int16_t  val2 = 0, fused2 = 0;
+        uint32_t val3 = 0, fused3 = 0;
+        int16_t  val4 = 0, fused4 = 0;
+
+        chained.extract(val1, nbBits1).extract(val2, nbBits2).extract(val3, nbBits3).extract(val4, nbBits4);
+        fused >> bits::fused<nbBits1, nbBits2, nbBits3, nbBits4>(fused1, fused2, fused3, fused4);
+
+        ASSERT_EQ(fused1, val1) << "offset = " << offset;
+        ASSERT_EQ(fused2, val2) << "offset = " << offset;
+        ASSERT_EQ(fused3, val3) << "offset = " << offset;
+        ASSERT_EQ(fused4, val4) << "offset = " << offset;
+        ASSERT_EQ(fused.nbBitsStreamed(), chained.nbBitsStreamed());
+
+        std::array<std::byte, BUFFER.size()> chainedBuffer = {};
+        std::array<std::byte, BUFFER.size()> fusedBuffer = {};
+        bits::BasicBitsSerializer<Order> chainedSerializer(chainedBuffer, offset);
+        bits::BasicBitsSerializer<Order> fusedSerializer(fusedBuffer, offset);
+
+        chainedSerializer.insert(val1, nbBits1).insert(val2, nbBits2).insert(val3, nbBits3).insert(val4, nbBits4);
+        fusedSerializer << bits::fused<nbBits1, nbBits2, nbBits3, nbBits4>(val1, val2, val3, val4);
+
+        ASSERT_THAT(fusedBuffer, ElementsAreArray(chainedBuffer)) << "offset = " << offset;
+    }
+}
+
+TEST(FusedFields, SameAsChained)
+{
+    checkSameAsChained<bits::MsbFirstBigEndian>();
+    checkSameAsChained<bits::MsbFirstLittleEndian>();
+    checkSameAsChained<bits::LsbFirstLittleEndian>();
+    checkSameAsChained<bits::LsbFirstBigEndian>();
+}
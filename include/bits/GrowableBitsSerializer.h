@@ -0,0 +1,280 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_GROWABLE_BITS_SERIALIZER_H
+#define BITS_GROWABLE_BITS_SERIALIZER_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <climits>
+#include <concepts>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <bits/bits_insertion.h>
+#include <bits/BitsOrder.h>
+#include <bits/BoundsCheck.h>
+#include <bits/detail/Traits.h>
+#include <bits/detail/BitsStream.h>
+
+namespace bits {
+
+namespace detail {
+
+//-----------------------------------------------------------------------------
+//- Resizable contiguous store of bytes (std::vector<std::byte>, with any
+//- allocator, such as std::pmr::vector<std::byte> for a caller supplied arena)
+//-----------------------------------------------------------------------------
+template<typename B>
+concept growable_buffer = requires(B & buffer, size_t size) {
+    { buffer.data() } -> std::same_as<std::byte *>;
+    { buffer.size() } -> std::convertible_to<size_t>;
+    buffer.resize(size);
+};
+
+} // namespace detail
+
+//-----------------------------------------------------------------------------
+//- Growable bits serializer class : the buffer grows (geometrically) with the
+//- insertions instead of throwing when its end is reached. The buffer is
+//- either owned by the serializer ('Buffer' being a value type), or borrowed
+//- ('Buffer' being a reference type).
+//-
+//- The number of bytes written is the one of the furthest inserted bit. The
+//- written bytes are accessed by 'bytes()', and handed out without copy by
+//- 'release()' (or 'finish()' for a borrowed buffer), the buffer being then
+//- resized to the written bytes.
+//-
+//- As the buffer grows before each insertion, insertions are always in bounds
+//- (so not checked).
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename Buffer = std::vector<std::byte>>
+requires detail::growable_buffer<std::remove_reference_t<Buffer>>
+class BasicGrowableBitsSerializer : public detail::BitsStream<BasicGrowableBitsSerializer<Order, Buffer>, UncheckedBounds>
+{
+public:
+    inline BasicGrowableBitsSerializer(Buffer buffer = Buffer(), size_t initialOffsetBits = 0);
+
+    template<detail::input_basic_type T>
+    inline BasicGrowableBitsSerializer & insert(T val, size_t nbBits = sizeof(T) * CHAR_BIT);
+    template<std::ranges::input_range R>
+    inline BasicGrowableBitsSerializer & insert(R && r, size_t nbBits = sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
+
+    inline BasicGrowableBitsSerializer & skip(size_t nbBits);
+    inline BasicGrowableBitsSerializer & reserve(size_t nbBits);
+
+    inline size_t                           nbBytesWritten(void) const noexcept;
+    inline std::span<const std::byte>       bytes(void) const noexcept;
+    inline std::remove_reference_t<Buffer> & finish(void);
+    inline std::remove_reference_t<Buffer>   release(void) requires(not std::is_reference_v<Buffer>);
+
+protected:
+    using Base = detail::BitsStream<BasicGrowableBitsSerializer<Order, Buffer>, UncheckedBounds>;
+    using Base::lengthBits;
+    using Base::posBits;
+    using Base::nbBitsNext;
+
+    inline void grow(size_t nbBits);
+    inline void written(size_t nbBits) noexcept;
+
+    Buffer buffer;
+    size_t endBits;
+};
+
+using GrowableBitsSerializer = BasicGrowableBitsSerializer<DefaultBitsOrder>;
+
+template<detail::bits_order Order, typename Buffer, detail::input_basic_type T>
+inline BasicGrowableBitsSerializer<Order, Buffer> & operator <<(BasicGrowableBitsSerializer<Order, Buffer> & bs, T val);
+template<detail::bits_order Order, typename Buffer, std::ranges::input_range R>
+inline BasicGrowableBitsSerializer<Order, Buffer> & operator <<(BasicGrowableBitsSerializer<Order, Buffer> & bs, R && r);
+template<detail::bits_order Order, typename Buffer>
+inline BasicGrowableBitsSerializer<Order, Buffer> & operator <<(BasicGrowableBitsSerializer<Order, Buffer> & bs, const detail::BitsStreamManipulation manip);
+
+
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename Buffer>
+requires detail::growable_buffer<std::remove_reference_t<Buffer>>
+inline BasicGrowableBitsSerializer<Order, Buffer>::BasicGrowableBitsSerializer(Buffer buffer_, size_t initialOffsetBits)
+: Base(buffer_.size() * CHAR_BIT, initialOffsetBits), buffer(std::forward<Buffer>(buffer_)), endBits(initialOffsetBits)
+{}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename Buffer>
+requires detail::growable_buffer<std::remove_reference_t<Buffer>>
+template<detail::input_basic_type T>
+inline BasicGrowableBitsSerializer<Order, Buffer> & BasicGrowableBitsSerializer<Order, Buffer>::insert(T val, size_t nbBits)
+{
+    auto nbBitsToInsert = nbBitsNext ? nbBitsNext : nbBits;
+    grow(nbBitsToInsert);
+
+    bits::insert(Order{}, std::span<std::byte>(buffer.data(), buffer.size()), val, posBits + nbBitsToInsert - 1, posBits);
+    written(nbBitsToInsert);
+    posBits += nbBitsToInsert;
+    nbBitsNext = 0;
+
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename Buffer>
+requires detail::growable_buffer<std::remove_reference_t<Buffer>>
+template<std::ranges::input_range R>
+inline BasicGrowableBitsSerializer<Order, Buffer> & BasicGrowableBitsSerializer<Order, Buffer>::insert(R && r, size_t nbBits)
+{
+    auto nbBitsToInsertByElement = nbBitsNext ? nbBitsNext : nbBits;
+    auto nbBitsToInsert = nbBitsToInsertByElement * detail::range_size(std::forward<R>(r));
+    grow(nbBitsToInsert);
+
+    bits::insert(Order{}, std::span<std::byte>(buffer.data(), buffer.size()), std::forward<R>(r), posBits + nbBitsToInsert - 1, posBits, nbBitsToInsertByElement);
+    written(nbBitsToInsert);
+    posBits += nbBitsToInsert;
+    nbBitsNext = 0;
+
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+//- Skipped bits are part of the written bytes (as zeros when not previously
+//- written)
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename Buffer>
+requires detail::growable_buffer<std::remove_reference_t<Buffer>>
+inline BasicGrowableBitsSerializer<Order, Buffer> & BasicGrowableBitsSerializer<Order, Buffer>::skip(size_t nbBits)
+{
+    grow(nbBits);
+    written(nbBits);
+    posBits += nbBits;
+
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename Buffer>
+requires detail::growable_buffer<std::remove_reference_t<Buffer>>
+inline BasicGrowableBitsSerializer<Order, Buffer> & BasicGrowableBitsSerializer<Order, Buffer>::reserve(size_t nbBits)
+{
+    grow(nbBits);
+
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename Buffer>
+requires detail::growable_buffer<std::remove_reference_t<Buffer>>
+inline size_t BasicGrowableBitsSerializer<Order, Buffer>::nbBytesWritten(void) const noexcept
+{
+    return (endBits + CHAR_BIT - 1) / CHAR_BIT;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename Buffer>
+requires detail::growable_buffer<std::remove_reference_t<Buffer>>
+inline std::span<const std::byte> BasicGrowableBitsSerializer<Order, Buffer>::bytes(void) const noexcept
+{
+    return { buffer.data(), nbBytesWritten() };
+}
+
+//-----------------------------------------------------------------------------
+//- Shrinking a vector doesn't reallocate it : the buffer is handed out as is
+//- (its allocator being kept by the serializer for the next message)
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename Buffer>
+requires detail::growable_buffer<std::remove_reference_t<Buffer>>
+inline std::remove_reference_t<Buffer> & BasicGrowableBitsSerializer<Order, Buffer>::finish(void)
+{
+    buffer.resize(nbBytesWritten());
+    lengthBits = buffer.size() * CHAR_BIT;
+
+    return buffer;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename Buffer>
+requires detail::growable_buffer<std::remove_reference_t<Buffer>>
+inline std::remove_reference_t<Buffer> BasicGrowableBitsSerializer<Order, Buffer>::release(void) requires(not std::is_reference_v<Buffer>)
+{
+    auto released = std::move(finish());
+
+    buffer.resize(0);
+    lengthBits = 0;
+    endBits = 0;
+    Base::reset();
+
+    return released;
+}
+
+//-----------------------------------------------------------------------------
+//- The buffer size is at least doubled, so that the insertions cost an
+//- amortized constant time
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename Buffer>
+requires detail::growable_buffer<std::remove_reference_t<Buffer>>
+inline void BasicGrowableBitsSerializer<Order, Buffer>::grow(size_t nbBits)
+{
+    constexpr size_t MIN_SIZE = 64;
+
+    if((posBits + nbBits) <= lengthBits)
+        return;
+
+    const size_t neededSize = (posBits + nbBits + CHAR_BIT - 1) / CHAR_BIT;
+    size_t newSize = buffer.size() < MIN_SIZE ? MIN_SIZE : buffer.size() * 2;
+    if(newSize < neededSize)
+        newSize = neededSize;
+
+    buffer.resize(newSize);
+    lengthBits = buffer.size() * CHAR_BIT;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename Buffer>
+requires detail::growable_buffer<std::remove_reference_t<Buffer>>
+inline void BasicGrowableBitsSerializer<Order, Buffer>::written(size_t nbBits) noexcept
+{
+    if((posBits + nbBits) > endBits)
+        endBits = posBits + nbBits;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename Buffer, detail::input_basic_type T>
+inline BasicGrowableBitsSerializer<Order, Buffer> & operator <<(BasicGrowableBitsSerializer<Order, Buffer> & bs, T val)
+{
+    return bs.insert(val);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename Buffer, std::ranges::input_range R>
+inline BasicGrowableBitsSerializer<Order, Buffer> & operator <<(BasicGrowableBitsSerializer<Order, Buffer> & bs, R && r)
+{
+    return bs.insert(std::forward<R>(r), sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
+}
+
+//-----------------------------------------------------------------------------
+//- Skipping bits by manipulation grows the buffer too
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename Buffer>
+inline BasicGrowableBitsSerializer<Order, Buffer> & operator <<(BasicGrowableBitsSerializer<Order, Buffer> & bs, const detail::BitsStreamManipulation manip)
+{
+    if(manip.action == detail::BitsStreamManipulation::Action::SKIP_BITS)
+        return bs.skip(manip.value);
+
+    bs.setManipulation(manip);
+    return bs;
+}
+
+} // namespace bits
+
+#endif /* BITS_GROWABLE_BITS_SERIALIZER_H */
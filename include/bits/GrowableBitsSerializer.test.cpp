@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <array>
+#include <vector>
+#include <memory_resource>
+#include <cstddef>
+
+#include <bits/GrowableBitsSerializer.h>
+
+using ::testing::ElementsAreArray;
+
+template<typename T = std::byte, typename... Ts>
+constexpr std::array<T, sizeof...(Ts)> make_array(Ts && ... args) noexcept
+{
+    return { T(std::forward<Ts>(args))... };
+}
+
+//-----------------------------------------------------------------------------
+TEST(GrowableBitsSerializer, ChainedInsert)
+{
+    bits::GrowableBitsSerializer serializer;
+
+    serializer
+        .insert(uint8_t { 0x03 }, 4)
+        .insert(uint8_t { 0x01 }, 2)
+        .insert(uint8_t { 0x7F }, 8)
+        .insert(uint8_t { 0xDC }, 8)
+        .insert(uint8_t { 0x0D }, 8)
+    ;
+
+    ASSERT_EQ(serializer.nbBitsStreamed(), 30);
+    ASSERT_EQ(serializer.nbBytesWritten(), 4);
+    ASSERT_THAT(serializer.bytes(), ElementsAreArray(make_array(0x35, 0xFF, 0x70, 0x34)));
+}
+
+TEST(GrowableBitsSerializer, Grow)
+{
+    bits::GrowableBitsSerializer serializer;
+    std::vector<std::byte> expected;
+
+    for(size_t i=0; i<1000; i++)
+    {
+        serializer << bits::nbits(4) << uint8_t(i) << bits::nbits(4) << uint8_t(i >> 4) << uint16_t(i);
+        expected.push_back(std::byte(((i & 0xF) << 4) | ((i >> 4) & 0xF)));
+        expected.push_back(std::byte(i >> 8));
+        expected.push_back(std::byte(i));
+    }
+
+    ASSERT_EQ(serializer.nbBytesWritten(), 3000);
+    ASSERT_THAT(serializer.bytes(), ElementsAreArray(expected));
+}
+
+TEST(GrowableBitsSerializer, SkipAndReset)
+{
+    bits::GrowableBitsSerializer serializer;
+
+    serializer << bits::skip(12) << uint8_t(0xAB) << bits::reset() << bits::nbits(4) << uint8_t(0x5);
+    ASSERT_EQ(serializer.nbBitsStreamed(), 4);
+    ASSERT_THAT(serializer.bytes(), ElementsAreArray(make_array(0x50, 0x0A, 0xB0)));
+
+    serializer.skip(40);
+    ASSERT_EQ(serializer.nbBytesWritten(), 6);
+}
+
+TEST(GrowableBitsSerializer, Ranges)
+{
+    bits::GrowableBitsSerializer serializer;
+    std::vector<uint16_t> values(100, 0xCAFE);
+
+    serializer << bits::nbits(4) << uint8_t(0xF) << values;
+
+    ASSERT_EQ(serializer.nbBytesWritten(), 201);
+    ASSERT_EQ(serializer.bytes()[0], std::byte(0xFC));
+    ASSERT_EQ(serializer.bytes()[199], std::byte(0xAF));
+    ASSERT_EQ(serializer.bytes()[200], std::byte(0xE0));
+}
+
+TEST(GrowableBitsSerializer, Release)
+{
+    bits::GrowableBitsSerializer serializer;
+
+    serializer << uint32_t(0xCAFEBABE) << bits::nbits(4) << uint8_t(0xA);
+    const auto * data = serializer.bytes().data();
+
+    auto bytes = serializer.release();
+    ASSERT_EQ(bytes.data(), data);
+    ASSERT_THAT(bytes, ElementsAreArray(make_array(0xCA, 0xFE, 0xBA, 0xBE, 0xA0)));
+
+    ASSERT_EQ(serializer.nbBitsStreamed(), 0);
+    ASSERT_EQ(serializer.nbBytesWritten(), 0);
+    serializer << uint8_t(0x35);
+    ASSERT_THAT(serializer.bytes(), ElementsAreArray(make_array(0x35)));
+}
+
+TEST(GrowableBitsSerializer, Borrowed)
+{
+    std::vector<std::byte> buffer = { std::byte(0xFF), std::byte(0xFF) };
+    bits::BasicGrowableBitsSerializer<bits::MsbFirstBigEndian, std::vector<std::byte> &> serializer(buffer, 12);
+
+    serializer << uint16_t(0x1234) << bits::nbits(4) << uint8_t(0x0);
+
+    ASSERT_EQ(&serializer.finish(), &buffer);
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0xFF, 0xF1, 0x23, 0x40)));
+}
+
+TEST(GrowableBitsSerializer, Arena)
+{
+    std::array<std::byte, 1024> arena;
+    std::pmr::monotonic_buffer_resource resource(arena.data(), arena.size(), std::pmr::null_memory_resource());
+    bits::BasicGrowableBitsSerializer<bits::LsbFirstLittleEndian, std::pmr::vector<std::byte>> serializer { std::pmr::vector<std::byte>(&resource) };
+
+    serializer.insert(uint8_t(0x05), 4).insert(uint8_t(0x03), 4);
+    serializer << uint16_t(0x70FF) << uint32_t(0x3570FF35);
+
+    const auto bytes = serializer.release();
+    ASSERT_GE(bytes.data(), arena.data());
+    ASSERT_LT(bytes.data(), arena.data() + arena.size());
+    ASSERT_THAT(bytes, ElementsAreArray(make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35)));
+}
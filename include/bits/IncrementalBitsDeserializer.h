@@ -0,0 +1,199 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_INCREMENTAL_BITS_DESERIALIZER_H
+#define BITS_INCREMENTAL_BITS_DESERIALIZER_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <climits>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include <bits/bits_extraction.h>
+#include <bits/BitsOrder.h>
+#include <bits/detail/Traits.h>
+
+namespace bits {
+
+//-----------------------------------------------------------------------------
+//- Incremental bits deserializer class : extractions from an input arriving
+//- in pieces (such as a TCP byte stream), fed as they arrive.
+//-
+//- Extractions are tried : when too few bits have been fed, nothing is
+//- extracted, and the extraction is to be tried again after the next feed
+//- (the caller keeping track of the fields already extracted, as a state
+//- machine). Extracted bits are never extracted again : the bytes fully
+//- extracted are discarded on the next feed, and only the bytes not yet
+//- extracted (including a partially extracted byte) are kept, copied into an
+//- internal buffer.
+//-
+//- Large ranges are extracted as their elements arrive by
+//- 'extractAvailable()', and skipping bits not yet fed discards them when
+//- they arrive.
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order>
+class BasicIncrementalBitsDeserializer
+{
+public:
+    inline BasicIncrementalBitsDeserializer(size_t initialOffsetBits = 0);
+
+    inline BasicIncrementalBitsDeserializer & feed(const std::span<const std::byte> bytes);
+
+    template<detail::output_basic_type T>
+    inline bool tryExtract(T & val, size_t nbBits = sizeof(T) * CHAR_BIT);
+    template<detail::output_range R>
+    inline bool tryExtract(R && r, size_t nbBits = sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
+    template<detail::output_range R>
+    inline size_t extractAvailable(R && r, size_t nbBits = sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
+
+    inline BasicIncrementalBitsDeserializer & skip(size_t nbBits) noexcept;
+
+    inline size_t nbBitsAvailable(void) const noexcept;
+    inline size_t nbBitsStreamed(void) const noexcept;
+
+protected:
+    std::vector<std::byte> buffer;
+    const size_t offsetBits;
+    size_t posBits;
+    size_t nbBitsDiscarded;
+};
+
+using IncrementalBitsDeserializer = BasicIncrementalBitsDeserializer<DefaultBitsOrder>;
+
+
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order>
+inline BasicIncrementalBitsDeserializer<Order>::BasicIncrementalBitsDeserializer(size_t initialOffsetBits)
+: buffer(), offsetBits(initialOffsetBits), posBits(initialOffsetBits), nbBitsDiscarded(0)
+{}
+
+//-----------------------------------------------------------------------------
+//- Bytes already extracted (or skipped) are discarded, from the internal
+//- buffer first, then from the fed bytes
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order>
+inline BasicIncrementalBitsDeserializer<Order> & BasicIncrementalBitsDeserializer<Order>::feed(std::span<const std::byte> bytes)
+{
+    auto nbBytesToDiscard = posBits / CHAR_BIT;
+
+    if(nbBytesToDiscard > buffer.size())
+        nbBytesToDiscard = buffer.size();
+    buffer.erase(buffer.begin(), buffer.begin() + nbBytesToDiscard);
+    posBits         -= nbBytesToDiscard * CHAR_BIT;
+    nbBitsDiscarded += nbBytesToDiscard * CHAR_BIT;
+
+    nbBytesToDiscard = posBits / CHAR_BIT;
+    if(nbBytesToDiscard > bytes.size())
+        nbBytesToDiscard = bytes.size();
+    bytes            = bytes.subspan(nbBytesToDiscard);
+    posBits         -= nbBytesToDiscard * CHAR_BIT;
+    nbBitsDiscarded += nbBytesToDiscard * CHAR_BIT;
+
+    buffer.insert(buffer.end(), bytes.begin(), bytes.end());
+
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order>
+template<detail::output_basic_type T>
+inline bool BasicIncrementalBitsDeserializer<Order>::tryExtract(T & val, size_t nbBits)
+{
+    if(nbBits > nbBitsAvailable())
+        return false;
+
+    if(nbBits > 0)
+        bits::extract(Order{}, buffer, val, posBits + nbBits - 1, posBits);
+    posBits += nbBits;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order>
+template<detail::output_range R>
+inline bool BasicIncrementalBitsDeserializer<Order>::tryExtract(R && r, size_t nbBits)
+{
+    const auto nbBitsToExtract = nbBits * detail::range_size(std::forward<R>(r));
+
+    if(nbBitsToExtract > nbBitsAvailable())
+        return false;
+
+    if(nbBitsToExtract > 0)
+        bits::extract(Order{}, buffer, std::forward<R>(r), posBits + nbBitsToExtract - 1, posBits, nbBits);
+    posBits += nbBitsToExtract;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+//- Extract the first elements of the range whose bits have been fed, and
+//- return their number (the remaining elements to be extracted after the next
+//- feed, for example from a subrange)
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order>
+template<detail::output_range R>
+inline size_t BasicIncrementalBitsDeserializer<Order>::extractAvailable(R && r, size_t nbBits)
+{
+    const auto nbElements = detail::range_size(std::forward<R>(r));
+
+    if(nbBits == 0)
+        return nbElements;
+
+    const auto nbAvailableElements = nbBitsAvailable() / nbBits;
+    const auto nbElementsToExtract = (nbAvailableElements < nbElements) ? nbAvailableElements : nbElements;
+    const auto nbBitsToExtract = nbElementsToExtract * nbBits;
+
+    if(nbElementsToExtract > 0)
+    {
+        auto first = std::ranges::begin(r);
+        bits::extract(Order{}, buffer, first, std::ranges::next(first, nbElementsToExtract), posBits + nbBitsToExtract - 1, posBits, nbBits);
+    }
+    posBits += nbBitsToExtract;
+
+    return nbElementsToExtract;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order>
+inline BasicIncrementalBitsDeserializer<Order> & BasicIncrementalBitsDeserializer<Order>::skip(size_t nbBits) noexcept
+{
+    posBits += nbBits;
+
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order>
+inline size_t BasicIncrementalBitsDeserializer<Order>::nbBitsAvailable(void) const noexcept
+{
+    const auto nbBitsBuffered = buffer.size() * CHAR_BIT;
+
+    return (posBits < nbBitsBuffered) ? (nbBitsBuffered - posBits) : 0;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order>
+inline size_t BasicIncrementalBitsDeserializer<Order>::nbBitsStreamed(void) const noexcept
+{
+    return nbBitsDiscarded + posBits - offsetBits;
+}
+
+} // namespace bits
+
+#endif /* BITS_INCREMENTAL_BITS_DESERIALIZER_H */
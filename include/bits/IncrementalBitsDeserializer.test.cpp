@@ -0,0 +1,193 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <array>
+#include <span>
+#include <vector>
+#include <cstddef>
+
+#include <bits/IncrementalBitsDeserializer.h>
+#include <bits/Uint.h>
+
+using ::testing::ElementsAreArray;
+
+template<typename T = std::byte, typename... Ts>
+constexpr std::array<const T, sizeof...(Ts)> make_array(Ts && ... args) noexcept
+{
+    return { T(std::forward<Ts>(args))... };
+}
+
+const auto MESSAGE = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+//-----------------------------------------------------------------------------
+//- Message parsing state machine, resumed after each feed
+//-----------------------------------------------------------------------------
+struct Parser
+{
+    bool parse(bits::IncrementalBitsDeserializer & deserializer)
+    {
+        switch(step)
+        {
+            case 0: if(not deserializer.tryExtract(val1, 16)) return false; step++; [[fallthrough]];
+            case 1: if(not deserializer.tryExtract(val2))     return false; step++; [[fallthrough]];
+            case 2: if(not deserializer.tryExtract(val3, 12)) return false; step++; [[fallthrough]];
+            case 3: if(not deserializer.tryExtract(val4, 28)) return false; step++; [[fallthrough]];
+            default: return true;
+        }
+    }
+
+    void check(void) const
+    {
+        ASSERT_EQ(val1, 0x5FF7);
+        ASSERT_EQ(val2, 0x035FF703'5FFCAFEBu);
+        ASSERT_EQ(val3, -1'346);
+        ASSERT_EQ(val4, 0x0A5B6C7Du);
+    }
+
+    int step = 0;
+    uint16_t val1 = 0;
+    uint64_t val2 = 0;
+    int16_t  val3 = 0;
+    uint32_t val4 = 0;
+};
+
+//-----------------------------------------------------------------------------
+TEST(IncrementalBitsDeserializer, TryExtract)
+{
+    bits::IncrementalBitsDeserializer deserializer;
+    uint32_t val = 0;
+
+    deserializer.feed(std::span(MESSAGE).first(3));
+    ASSERT_FALSE(deserializer.tryExtract(val));
+    ASSERT_EQ(val, 0u);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 0);
+    ASSERT_EQ(deserializer.nbBitsAvailable(), 24);
+
+    deserializer.feed(std::span(MESSAGE).subspan(3, 1));
+    ASSERT_TRUE(deserializer.tryExtract(val));
+    ASSERT_EQ(val, 0x35FF7035u);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 32);
+    ASSERT_EQ(deserializer.nbBitsAvailable(), 0);
+}
+
+TEST(IncrementalBitsDeserializer, Feed_ByteByByte)
+{
+    bits::IncrementalBitsDeserializer deserializer(4);
+    Parser parser;
+
+    for(size_t i=0; i<MESSAGE.size(); i++)
+    {
+        ASSERT_FALSE(parser.parse(deserializer));
+        deserializer.feed(std::span(MESSAGE).subspan(i, 1));
+        ASSERT_LE(deserializer.nbBitsAvailable(), 64 + 8);
+    }
+
+    ASSERT_TRUE(parser.parse(deserializer));
+    parser.check();
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 120);
+}
+
+TEST(IncrementalBitsDeserializer, Feed_Split)
+{
+    for(size_t split=0; split<=MESSAGE.size(); split++)
+    {
+        bits::IncrementalBitsDeserializer deserializer(4);
+        Parser parser;
+
+        deserializer.feed(std::span(MESSAGE).first(split));
+        ASSERT_EQ(parser.parse(deserializer), split == MESSAGE.size());
+
+        deserializer.feed(std::span(MESSAGE).subspan(split));
+        ASSERT_TRUE(parser.parse(deserializer));
+        parser.check();
+    }
+}
+
+TEST(IncrementalBitsDeserializer, Skip_NotYetFed)
+{
+    bits::IncrementalBitsDeserializer deserializer;
+    uint16_t val = 0;
+
+    deserializer.skip(76);
+    deserializer.feed(std::span(MESSAGE).first(5)).feed(std::span(MESSAGE).subspan(5, 4));
+    ASSERT_EQ(deserializer.nbBitsAvailable(), 0);
+    ASSERT_FALSE(deserializer.tryExtract(val));
+
+    deserializer.feed(std::span(MESSAGE).subspan(9, 3));
+    ASSERT_TRUE(deserializer.tryExtract(val));
+    ASSERT_EQ(val, 0xEBAB);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 92);
+}
+
+TEST(IncrementalBitsDeserializer, Ranges)
+{
+    bits::IncrementalBitsDeserializer deserializer;
+    std::array<uint8_t, 3> array = {};
+    std::vector<uint16_t> vector(6, 0);
+    size_t nbExtracted = 0;
+
+    deserializer.feed(std::span(MESSAGE).first(2));
+    ASSERT_FALSE(deserializer.tryExtract(array));
+    deserializer.feed(std::span(MESSAGE).subspan(2, 2));
+    ASSERT_TRUE(deserializer.tryExtract(array));
+
+    for(size_t i=4; i<MESSAGE.size(); i+=3)
+    {
+        nbExtracted += deserializer.extractAvailable(std::span(vector).subspan(nbExtracted));
+        deserializer.feed(std::span(MESSAGE).subspan(i, std::min<size_t>(3, MESSAGE.size() - i)));
+    }
+    nbExtracted += deserializer.extractAvailable(std::span(vector).subspan(nbExtracted));
+
+    ASSERT_EQ(nbExtracted, 6);
+    ASSERT_THAT(array, ElementsAreArray(make_array<uint8_t>(0x35, 0xFF, 0x70)));
+    ASSERT_THAT(vector, ElementsAreArray(make_array<uint16_t>(0x35FF, 0x7035, 0xFFCA, 0xFEBA, 0xBEA5, 0xB6C7)));
+    ASSERT_EQ(deserializer.nbBitsAvailable(), 8);
+}
+
+TEST(IncrementalBitsDeserializer, BitsOrder)
+{
+    bits::BasicIncrementalBitsDeserializer<bits::LsbFirstLittleEndian> deserializer;
+    uint8_t val1 = 0;
+    uint8_t val2 = 0;
+    uint16_t val3 = 0;
+    uint32_t val4 = 0;
+
+    deserializer.feed(std::span(MESSAGE).first(2));
+    ASSERT_TRUE(deserializer.tryExtract(val1, 4));
+    ASSERT_TRUE(deserializer.tryExtract(val2, 4));
+    ASSERT_FALSE(deserializer.tryExtract(val3));
+    deserializer.feed(std::span(MESSAGE).subspan(2, 5));
+    ASSERT_TRUE(deserializer.tryExtract(val3));
+    ASSERT_TRUE(deserializer.tryExtract(val4));
+
+    ASSERT_EQ(val1, 0x05);
+    ASSERT_EQ(val2, 0x03);
+    ASSERT_EQ(val3, 0x70FF);
+    ASSERT_EQ(val4, 0x3570FF35u);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 56);
+}
+
+TEST(IncrementalBitsDeserializer, Wide)
+{
+    bits::IncrementalBitsDeserializer deserializer;
+    uint8_t val1 = 0;
+    bits::uint<96> val2;
+    bits::uint<24> val3;
+
+    deserializer.feed(std::span(MESSAGE).first(7));
+    ASSERT_TRUE(deserializer.tryExtract(val1));
+    ASSERT_FALSE(deserializer.tryExtract(val2));
+    deserializer.feed(std::span(MESSAGE).subspan(7));
+    ASSERT_TRUE(deserializer.tryExtract(val2));
+    ASSERT_TRUE(deserializer.tryExtract(val3, 20));
+
+    ASSERT_EQ(val1, 0x35);
+    ASSERT_EQ(val2, bits::uint<96>(0xFF7035FF, 0x7035FFCAFEBABEA5));
+    ASSERT_EQ(val3, bits::uint<24>(0xB6C7D));
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 124);
+}
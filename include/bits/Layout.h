@@ -0,0 +1,722 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_LAYOUT_H
+#define BITS_LAYOUT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <climits>
+#include <cassert>
+#include <array>
+#include <variant>
+#include <algorithm>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <ranges>
+#include <type_traits>
+
+#include <bits/bits_insertion.h>
+#include <bits/bits_extraction.h>
+#include <bits/BitsOrder.h>
+#include <bits/detail/Traits.h>
+
+namespace bits {
+
+namespace detail {
+
+//-----------------------------------------------------------------------------
+//- Traits of a pointer to data member : class and member types
+//-----------------------------------------------------------------------------
+template<typename T>
+struct member_pointer_traits;
+
+template<typename C, typename T>
+struct member_pointer_traits<T C::*>
+{
+    using class_type  = C;
+    using member_type = T;
+};
+
+//-----------------------------------------------------------------------------
+//- Element type of a layout field (the element type of a std::array member)
+//-----------------------------------------------------------------------------
+template<typename T, bool = is_std_array_v<T>>
+struct field_element { using type = T;                       static constexpr size_t nb_elements = 1; };
+template<typename T>
+struct field_element<T, true> { using type = typename T::value_type; static constexpr size_t nb_elements = std::tuple_size_v<T>; };
+
+template<auto member>
+using field_element_t = typename field_element<typename member_pointer_traits<decltype(member)>::member_type>::type;
+
+//-----------------------------------------------------------------------------
+//- Concept for the layout fields stored into a member of the message
+//-----------------------------------------------------------------------------
+template<typename F>
+concept member_field = requires { F::member_pointer; };
+template<typename F>
+concept variant_field = requires { F::key_pointer; F::payload_pointer; };
+template<typename F, typename Message>
+concept field_of = (not requires { typename F::class_type; }) or std::is_same_v<typename F::class_type, Message>;
+
+//-----------------------------------------------------------------------------
+//- Message structure of a layout (the class of its member fields)
+//-----------------------------------------------------------------------------
+template<typename... Fields>
+struct layout_message;
+
+template<typename F, typename... Fields>
+struct layout_message<F, Fields...> : layout_message<Fields...> {};
+
+template<member_field F, typename... Fields>
+struct layout_message<F, Fields...> { using type = typename F::class_type; };
+
+template<typename... Fields>
+using layout_message_t = typename layout_message<Fields...>::type;
+
+//-----------------------------------------------------------------------------
+//- Type of the data member pointed to
+//-----------------------------------------------------------------------------
+template<auto member>
+using member_type_t = typename member_pointer_traits<decltype(member)>::member_type;
+
+//-----------------------------------------------------------------------------
+//- First bit of each field of a layout
+//-----------------------------------------------------------------------------
+template<typename... Fields>
+inline constexpr std::array<size_t, sizeof...(Fields)> fields_low_bits(void) noexcept;
+
+//-----------------------------------------------------------------------------
+//- Index of the layout field of a data member (the number of fields if none)
+//-----------------------------------------------------------------------------
+template<auto member, typename F>
+inline constexpr bool is_field_of_member(void) noexcept;
+template<auto member, typename... Fields>
+inline constexpr size_t field_index(void) noexcept;
+
+//-----------------------------------------------------------------------------
+//- Dispatch tables of variant fields, from the keys of their cases : dense
+//- table of the case indexes by key value, or keys sorted for a binary search
+//-----------------------------------------------------------------------------
+inline constexpr size_t VARIANT_DENSE_KEYS = 256;
+
+template<typename Key, size_t N>
+inline constexpr uint64_t case_keys_range(const std::array<Key, N> & keys) noexcept;
+template<auto keys>
+inline constexpr auto case_dense_table(void) noexcept;
+template<auto keys>
+inline constexpr auto case_sorted_keys(void) noexcept;
+
+template<auto keys>
+inline constexpr auto case_dense_table_v = case_dense_table<keys>();
+template<auto keys>
+inline constexpr auto case_sorted_keys_v = case_sorted_keys<keys>();
+
+//-----------------------------------------------------------------------------
+//- First case of a variant field whose sub-layout decodes a message type
+//-----------------------------------------------------------------------------
+template<typename Message, typename... Cases>
+struct case_of_message;
+
+template<typename Message, typename C, typename... Cases>
+struct case_of_message<Message, C, Cases...> : std::conditional_t<std::is_same_v<typename C::message_type, Message>, std::type_identity<C>, case_of_message<Message, Cases...>> {};
+
+template<typename Message, typename... Cases>
+using case_of_message_t = typename case_of_message<Message, Cases...>::type;
+
+} // namespace detail
+
+//-----------------------------------------------------------------------------
+//- Field of a message layout : a data member of the message structure, with
+//- its number of bits (by element for std::array members, whose elements are
+//- consecutive)
+//-----------------------------------------------------------------------------
+template<auto member, size_t nbBits = sizeof(detail::field_element_t<member>) * CHAR_BIT>
+struct Field
+{
+    using class_type  = typename detail::member_pointer_traits<decltype(member)>::class_type;
+    using member_type = typename detail::member_pointer_traits<decltype(member)>::member_type;
+
+    static constexpr auto   member_pointer     = member;
+    static constexpr bool   is_range           = detail::is_std_array_v<member_type>;
+    static constexpr size_t nb_bits_by_element = nbBits;
+    static constexpr size_t nb_bits            = nbBits * detail::field_element<member_type>::nb_elements;
+
+    static_assert(nbBits > 0, "Layout field should not be empty");
+    static_assert(nbBits <= sizeof(detail::field_element_t<member>) * CHAR_BIT, "Layout field wider than its type");
+};
+
+//-----------------------------------------------------------------------------
+//- Padding of a message layout : reserved bits, skipped by 'decode()' and left
+//- untouched by 'encode()'
+//-----------------------------------------------------------------------------
+template<size_t nbBits>
+struct Padding
+{
+    static constexpr size_t nb_bits = nbBits;
+};
+
+//-----------------------------------------------------------------------------
+//- Case of a variant field : the sub-layout of the payload for a key value
+//-----------------------------------------------------------------------------
+template<auto keyValue, typename Layout>
+struct Case
+{
+    using layout       = Layout;
+    using message_type = typename Layout::message_type;
+
+    static constexpr auto key = keyValue;
+};
+
+//-----------------------------------------------------------------------------
+//- Variant field of a message layout : the remaining bytes of the message
+//- are decoded with the sub-layout of the case selected by the value of a
+//- previous field (such as the EtherType of an Ethernet frame), into a
+//- std::variant member holding std::monostate when no case matches.
+//-
+//- The variant field is the last field of the layout, whose fixed part
+//- should then be whole bytes. The sub-layout decodes the tail of the buffer
+//- in place (a subspan, without copy). The case is selected by a compile time
+//- table indexed by the key value when the keys of the cases are dense (up to
+//- 256 consecutive values), or by a binary search of the sorted keys.
+//-
+//-     using FrameLayout = bits::Layout<
+//-         bits::Field<&Frame::etherType>,
+//-         bits::Variant<&Frame::etherType, &Frame::payload,
+//-             bits::Case<EtherType::IP,   IpHeaderLayout>,
+//-             bits::Case<EtherType::VLAN, VlanTagLayout>
+//-         >
+//-     >;
+//-----------------------------------------------------------------------------
+template<auto keyMember, auto payloadMember, typename... Cases>
+class Variant
+{
+public:
+    using class_type   = typename detail::member_pointer_traits<decltype(keyMember)>::class_type;
+    using key_type     = detail::member_type_t<keyMember>;
+    using payload_type = detail::member_type_t<payloadMember>;
+
+    static constexpr auto   key_pointer     = keyMember;
+    static constexpr auto   payload_pointer = payloadMember;
+    static constexpr size_t nb_bits         = 0; // Not part of the fixed bits of the layout
+
+    static_assert(std::is_same_v<typename detail::member_pointer_traits<decltype(payloadMember)>::class_type, class_type>, "Variant key and payload should be members of the same message");
+    static_assert(std::is_enum_v<key_type> or std::is_integral_v<key_type>, "Variant key should be an enumeration or an integer");
+    static_assert(std::is_same_v<std::variant_alternative_t<0, payload_type>, std::monostate>, "Variant payload should be a std::variant, with std::monostate first");
+    static_assert((std::is_same_v<std::remove_cv_t<decltype(Cases::key)>, key_type> and ...), "Variant cases keys should be of the key type");
+    static_assert(sizeof...(Cases) > 0 and sizeof...(Cases) < UINT16_MAX, "Variant should have cases");
+
+protected:
+    using key_raw_type = typename std::conditional_t<std::is_enum_v<key_type>, std::underlying_type<key_type>, std::type_identity<key_type>>::type;
+    using Decoder      = void (*)(const std::span<const std::byte>, payload_type &);
+
+    static constexpr std::array<key_raw_type, sizeof...(Cases)> keys = { static_cast<key_raw_type>(Cases::key)... };
+
+public:
+    static constexpr bool dense_dispatch = detail::case_keys_range(keys) < detail::VARIANT_DENSE_KEYS;
+
+    static constexpr void   decode(const std::span<const std::byte> tail, class_type & message);
+    static constexpr void   encode(const class_type & message, const std::span<std::byte> tail);
+    static constexpr size_t size(const class_type & message);
+
+protected:
+    static constexpr size_t caseIndex(const key_type key) noexcept;
+
+    template<typename C> static constexpr void decodeCase(const std::span<const std::byte> tail, payload_type & payload);
+    static constexpr void decodeNone(const std::span<const std::byte> tail, payload_type & payload);
+
+    static constexpr std::array<Decoder, sizeof...(Cases) + 1> decoders = { &decodeCase<Cases>..., &decodeNone };
+};
+
+//-----------------------------------------------------------------------------
+//- Message layout : the fields of a message structure, declared once with
+//- their number of bits, in the order of the message bits.
+//-
+//- The bits range of every field is computed at compile time, so that
+//- 'decode()' and 'encode()' are a sequence of the compile time bits range
+//- extraction / insertion kernels, without any offset bookkeeping at runtime
+//- ('decode()' loading the bytes once for the fields covered by a same word).
+//- Members of the message structure not in the layout are left untouched.
+//-
+//-     using IpHeaderLayout = bits::Layout<
+//-         bits::Field<&IpHeader::version, 4>,
+//-         bits::Field<&IpHeader::ihl,     4>,
+//-         bits::Padding<8>,
+//-         bits::Field<&IpHeader::length>
+//-     >;
+//-
+//-     auto ipHeader = IpHeaderLayout::decode(buffer);
+//-     IpHeaderLayout::encode(ipHeader, buffer);
+//-----------------------------------------------------------------------------
+template<typename Layout, typename Byte>
+class LayoutView;
+
+template<detail::bits_order Order, typename... Fields>
+class BasicLayout
+{
+public:
+    using message_type = detail::layout_message_t<Fields...>;
+
+    static_assert((detail::field_of<Fields, message_type> and ...), "Layout fields should be members of the same message");
+
+    // Fixed part of the message (without the variant field, if any)
+    static constexpr size_t nb_bits  = (Fields::nb_bits + ...);
+    static constexpr size_t nb_bytes = (nb_bits + CHAR_BIT - 1) / CHAR_BIT;
+
+protected:
+    using last_field = std::tuple_element_t<sizeof...(Fields) - 1, std::tuple<Fields...>>;
+    static constexpr bool has_variant = detail::variant_field<last_field>;
+
+    static_assert((size_t(detail::variant_field<Fields>) + ...) == size_t(has_variant), "Variant field should be the last field of the layout");
+    static_assert(not has_variant or (nb_bits % CHAR_BIT) == 0, "Fields before a variant field should be whole bytes");
+
+public:
+
+    static constexpr message_type decode(const std::span<const std::byte> buffer);
+    static constexpr void         decode(const std::span<const std::byte> buffer, message_type & message);
+    static constexpr void         encode(const message_type & message, const std::span<std::byte> buffer);
+    static constexpr size_t       size(const message_type & message);
+
+    template<auto member>
+    static constexpr detail::member_type_t<member> get(const std::span<const std::byte> buffer);
+    template<auto member>
+    static constexpr void set(const std::span<std::byte> buffer, const detail::member_type_t<member> & val);
+
+    template<std::ranges::contiguous_range Buffer>
+    static constexpr auto view(Buffer && buffer);
+
+protected:
+    template<auto member> static constexpr size_t fieldIndex(void) noexcept;
+
+    static constexpr auto memberRanges(void) noexcept;
+    template<typename F> static constexpr auto memberTie(message_type & message) noexcept;
+
+    template<size_t I, typename F> static constexpr void encodeField(const message_type & message, const std::span<std::byte> buffer);
+    template<size_t I, typename F, typename T> static constexpr void extractField(const std::span<const std::byte> buffer, T & val);
+    template<size_t I, typename F, typename T> static constexpr void insertField(const T & val, const std::span<std::byte> buffer);
+};
+
+template<typename... Fields>
+using Layout = BasicLayout<DefaultBitsOrder, Fields...>;
+
+//-----------------------------------------------------------------------------
+//- Overlay view of a message layout : typed accessors over the message bytes,
+//- extracting (or inserting in place) only the field asked for, at its
+//- compile time bits range.
+//-
+//- Filtering messages on a few fields does not pay for decoding the others :
+//-     auto header = IpHeaderLayout::view(packet);
+//-     if(header.get<&IpHeader::protocol>() == Protocol::TCP)
+//-         header.set<&IpHeader::ttl>(64); // Mutable bytes only
+//-----------------------------------------------------------------------------
+template<typename Layout, typename Byte>
+class LayoutView
+{
+public:
+    static_assert(std::is_same_v<std::remove_const_t<Byte>, std::byte>, "Layout view should be over bytes");
+
+    constexpr explicit LayoutView(const std::span<Byte> buffer);
+
+    template<auto member>
+    constexpr detail::member_type_t<member> get(void) const;
+    template<auto member>
+    constexpr void set(const detail::member_type_t<member> & val) const requires (not std::is_const_v<Byte>);
+
+    constexpr typename Layout::message_type decode(void) const;
+    constexpr std::span<Byte> bytes(void) const noexcept;
+
+protected:
+    std::span<Byte> buffer;
+};
+
+
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename... Fields>
+constexpr typename BasicLayout<Order, Fields...>::message_type BasicLayout<Order, Fields...>::decode(const std::span<const std::byte> buffer)
+{
+    message_type message = {};
+    decode(buffer, message);
+
+    return message;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename... Fields>
+constexpr void BasicLayout<Order, Fields...>::decode(const std::span<const std::byte> buffer, message_type & message)
+{
+    assert((buffer.size() * CHAR_BIT) >= nb_bits);
+
+    std::apply([&](auto & ... members)
+    {
+        detail::extract_grouped<memberRanges()>(Order{}, buffer, members...);
+    }, std::tuple_cat(memberTie<Fields>(message)...));
+
+    if constexpr(has_variant)
+    {
+        static_assert(fieldIndex<last_field::key_pointer>() < sizeof...(Fields));
+        last_field::decode(buffer.subspan(nb_bytes), message);
+    }
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename... Fields>
+constexpr void BasicLayout<Order, Fields...>::encode(const message_type & message, const std::span<std::byte> buffer)
+{
+    assert((buffer.size() * CHAR_BIT) >= nb_bits);
+
+    [&]<size_t... I>(std::index_sequence<I...>)
+    {
+        (encodeField<I, Fields>(message, buffer), ...);
+    }(std::index_sequence_for<Fields...>{});
+
+    if constexpr(has_variant)
+        last_field::encode(message, buffer.subspan(nb_bytes));
+}
+
+//-----------------------------------------------------------------------------
+//- Number of bytes of the message, including the payload of the variant
+//- field (if any)
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename... Fields>
+constexpr size_t BasicLayout<Order, Fields...>::size(const message_type & message)
+{
+    if constexpr(has_variant)
+        return nb_bytes + last_field::size(message);
+    else
+        return nb_bytes;
+}
+
+//-----------------------------------------------------------------------------
+//- Only the bits range of the field is extracted / inserted
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename... Fields>
+template<auto member>
+constexpr detail::member_type_t<member> BasicLayout<Order, Fields...>::get(const std::span<const std::byte> buffer)
+{
+    constexpr size_t I = fieldIndex<member>();
+    assert((buffer.size() * CHAR_BIT) >= nb_bits);
+
+    detail::member_type_t<member> val = {};
+    extractField<I, std::tuple_element_t<I, std::tuple<Fields...>>>(buffer, val);
+
+    return val;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename... Fields>
+template<auto member>
+constexpr void BasicLayout<Order, Fields...>::set(const std::span<std::byte> buffer, const detail::member_type_t<member> & val)
+{
+    constexpr size_t I = fieldIndex<member>();
+    assert((buffer.size() * CHAR_BIT) >= nb_bits);
+
+    insertField<I, std::tuple_element_t<I, std::tuple<Fields...>>>(val, buffer);
+}
+
+//-----------------------------------------------------------------------------
+//- The view is over constant bytes for constant buffers, and over mutable
+//- bytes otherwise
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename... Fields>
+template<std::ranges::contiguous_range Buffer>
+constexpr auto BasicLayout<Order, Fields...>::view(Buffer && buffer)
+{
+    using Byte = std::remove_reference_t<std::ranges::range_reference_t<Buffer>>;
+
+    return LayoutView<BasicLayout, Byte>(std::span<Byte>(std::ranges::data(buffer), std::ranges::size(buffer)));
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename... Fields>
+template<auto member>
+constexpr size_t BasicLayout<Order, Fields...>::fieldIndex(void) noexcept
+{
+    constexpr size_t index = detail::field_index<member, Fields...>();
+    static_assert(index < sizeof...(Fields), "Data member not in the layout");
+
+    return index;
+}
+
+//-----------------------------------------------------------------------------
+//- Bits ranges of the member fields (the fields decoded at once, grouped by
+//- covering word)
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename... Fields>
+constexpr auto BasicLayout<Order, Fields...>::memberRanges(void) noexcept
+{
+    constexpr auto lowBits = detail::fields_low_bits<Fields...>();
+    std::array<detail::grouped_field, (size_t(detail::member_field<Fields>) + ...)> ranges = {};
+    size_t index  = 0;
+    size_t member = 0;
+
+    ([&]
+    {
+        if constexpr(detail::member_field<Fields>)
+            ranges[member++] = { lowBits[index] + Fields::nb_bits - 1, lowBits[index], Fields::nb_bits_by_element, not Fields::is_range and detail::groupable_v<typename Fields::member_type> };
+        index++;
+    }(), ...);
+
+    return ranges;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename... Fields>
+template<typename F>
+constexpr auto BasicLayout<Order, Fields...>::memberTie(message_type & message) noexcept
+{
+    if constexpr(detail::member_field<F>)
+        return std::tie(message.*F::member_pointer);
+    else
+        return std::tuple<>{};
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename... Fields>
+template<size_t I, typename F>
+constexpr void BasicLayout<Order, Fields...>::encodeField(const message_type & message, const std::span<std::byte> buffer)
+{
+    if constexpr(detail::member_field<F>)
+        insertField<I, F>(message.*F::member_pointer, buffer);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename... Fields>
+template<size_t I, typename F, typename T>
+constexpr void BasicLayout<Order, Fields...>::extractField(const std::span<const std::byte> buffer, T & val)
+{
+    constexpr size_t low  = detail::fields_low_bits<Fields...>()[I];
+    constexpr size_t high = low + F::nb_bits - 1;
+
+    if constexpr(F::is_range)
+        bits::extract<high, low, F::nb_bits_by_element>(Order{}, buffer, val);
+    else
+        bits::extract<high, low>(Order{}, buffer, val);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, typename... Fields>
+template<size_t I, typename F, typename T>
+constexpr void BasicLayout<Order, Fields...>::insertField(const T & val, const std::span<std::byte> buffer)
+{
+    constexpr size_t low  = detail::fields_low_bits<Fields...>()[I];
+    constexpr size_t high = low + F::nb_bits - 1;
+
+    if constexpr(F::is_range)
+        bits::insert<high, low, F::nb_bits_by_element>(Order{}, buffer, val);
+    else
+        bits::insert<high, low>(Order{}, buffer, val);
+}
+
+//-----------------------------------------------------------------------------
+//- Variant field
+//-----------------------------------------------------------------------------
+template<auto keyMember, auto payloadMember, typename... Cases>
+constexpr void Variant<keyMember, payloadMember, Cases...>::decode(const std::span<const std::byte> tail, class_type & message)
+{
+    decoders[caseIndex(message.*keyMember)](tail, message.*payloadMember);
+}
+
+//-----------------------------------------------------------------------------
+template<auto keyMember, auto payloadMember, typename... Cases>
+constexpr void Variant<keyMember, payloadMember, Cases...>::encode(const class_type & message, const std::span<std::byte> tail)
+{
+    std::visit([&]<typename Message>(const Message & payload)
+    {
+        if constexpr(not std::is_same_v<Message, std::monostate>)
+            detail::case_of_message_t<Message, Cases...>::layout::encode(payload, tail);
+    }, message.*payloadMember);
+}
+
+//-----------------------------------------------------------------------------
+template<auto keyMember, auto payloadMember, typename... Cases>
+constexpr size_t Variant<keyMember, payloadMember, Cases...>::size(const class_type & message)
+{
+    return std::visit([&]<typename Message>(const Message & payload) -> size_t
+    {
+        if constexpr(std::is_same_v<Message, std::monostate>)
+            return 0;
+        else
+            return detail::case_of_message_t<Message, Cases...>::layout::size(payload);
+    }, message.*payloadMember);
+}
+
+//-----------------------------------------------------------------------------
+//- Index of the case of a key (the number of cases if none), the first case
+//- winning for duplicated keys
+//-----------------------------------------------------------------------------
+template<auto keyMember, auto payloadMember, typename... Cases>
+constexpr size_t Variant<keyMember, payloadMember, Cases...>::caseIndex(const key_type key) noexcept
+{
+    const auto rawKey = static_cast<key_raw_type>(key);
+
+    if constexpr(dense_dispatch)
+    {
+        constexpr auto & table  = detail::case_dense_table_v<keys>;
+        constexpr auto   minKey = *std::min_element(keys.begin(), keys.end());
+        const auto index = static_cast<uint64_t>(rawKey) - static_cast<uint64_t>(minKey);
+
+        return (index < table.size()) ? table[index] : sizeof...(Cases);
+    }
+    else
+    {
+        constexpr auto & sorted = detail::case_sorted_keys_v<keys>;
+        const auto it = std::lower_bound(sorted.begin(), sorted.end(), rawKey, [](const auto & sortedKey, key_raw_type val) { return sortedKey.first < val; });
+
+        return (it != sorted.end() and it->first == rawKey) ? it->second : sizeof...(Cases);
+    }
+}
+
+//-----------------------------------------------------------------------------
+template<auto keyMember, auto payloadMember, typename... Cases>
+template<typename C>
+constexpr void Variant<keyMember, payloadMember, Cases...>::decodeCase(const std::span<const std::byte> tail, payload_type & payload)
+{
+    C::layout::decode(tail, payload.template emplace<typename C::message_type>());
+}
+
+//-----------------------------------------------------------------------------
+template<auto keyMember, auto payloadMember, typename... Cases>
+constexpr void Variant<keyMember, payloadMember, Cases...>::decodeNone(const std::span<const std::byte>, payload_type & payload)
+{
+    payload.template emplace<std::monostate>();
+}
+
+//-----------------------------------------------------------------------------
+//- Layout view
+//-----------------------------------------------------------------------------
+template<typename Layout, typename Byte>
+constexpr LayoutView<Layout, Byte>::LayoutView(const std::span<Byte> buffer_)
+: buffer(buffer_)
+{
+    assert((buffer.size() * CHAR_BIT) >= Layout::nb_bits);
+}
+
+//-----------------------------------------------------------------------------
+template<typename Layout, typename Byte>
+template<auto member>
+constexpr detail::member_type_t<member> LayoutView<Layout, Byte>::get(void) const
+{
+    return Layout::template get<member>(buffer);
+}
+
+//-----------------------------------------------------------------------------
+template<typename Layout, typename Byte>
+template<auto member>
+constexpr void LayoutView<Layout, Byte>::set(const detail::member_type_t<member> & val) const requires (not std::is_const_v<Byte>)
+{
+    Layout::template set<member>(buffer, val);
+}
+
+//-----------------------------------------------------------------------------
+template<typename Layout, typename Byte>
+constexpr typename Layout::message_type LayoutView<Layout, Byte>::decode(void) const
+{
+    return Layout::decode(buffer);
+}
+
+//-----------------------------------------------------------------------------
+template<typename Layout, typename Byte>
+constexpr std::span<Byte> LayoutView<Layout, Byte>::bytes(void) const noexcept
+{
+    return buffer;
+}
+
+namespace detail {
+
+//-----------------------------------------------------------------------------
+//- Each field starts right after the previous one
+//-----------------------------------------------------------------------------
+template<typename... Fields>
+inline constexpr std::array<size_t, sizeof...(Fields)> fields_low_bits(void) noexcept
+{
+    constexpr std::array<size_t, sizeof...(Fields)> nbBits = { Fields::nb_bits... };
+    std::array<size_t, sizeof...(Fields)> lowBits = {};
+
+    for(size_t i=1; i<nbBits.size(); i++)
+        lowBits[i] = lowBits[i - 1] + nbBits[i - 1];
+
+    return lowBits;
+}
+
+//-----------------------------------------------------------------------------
+template<auto member, typename F>
+inline constexpr bool is_field_of_member(void) noexcept
+{
+    if constexpr(member_field<F>)
+        if constexpr(std::is_same_v<decltype(member), std::remove_const_t<decltype(F::member_pointer)>>)
+            return member == F::member_pointer;
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+template<auto member, typename... Fields>
+inline constexpr size_t field_index(void) noexcept
+{
+    constexpr std::array<bool, sizeof...(Fields)> isFieldOfMember = { is_field_of_member<member, Fields>()... };
+
+    for(size_t i=0; i<isFieldOfMember.size(); i++)
+        if(isFieldOfMember[i])
+            return i;
+
+    return sizeof...(Fields);
+}
+
+//-----------------------------------------------------------------------------
+//- Keys are compared as unsigned 64 bits values, so that the range of signed
+//- keys is computed without overflow
+//-----------------------------------------------------------------------------
+template<typename Key, size_t N>
+inline constexpr uint64_t case_keys_range(const std::array<Key, N> & keys) noexcept
+{
+    const auto [minKey, maxKey] = std::minmax_element(keys.begin(), keys.end());
+
+    return static_cast<uint64_t>(*maxKey) - static_cast<uint64_t>(*minKey);
+}
+
+//-----------------------------------------------------------------------------
+template<auto keys>
+inline constexpr auto case_dense_table(void) noexcept
+{
+    constexpr auto minKey = *std::min_element(keys.begin(), keys.end());
+    std::array<uint16_t, case_keys_range(keys) + 1> table = {};
+
+    table.fill(static_cast<uint16_t>(keys.size()));
+    for(size_t i=keys.size(); i-- > 0; )
+        table[static_cast<uint64_t>(keys[i]) - static_cast<uint64_t>(minKey)] = static_cast<uint16_t>(i);
+
+    return table;
+}
+
+//-----------------------------------------------------------------------------
+template<auto keys>
+inline constexpr auto case_sorted_keys(void) noexcept
+{
+    using Key = typename decltype(keys)::value_type;
+    std::array<std::pair<Key, uint16_t>, keys.size()> sorted = {};
+
+    for(size_t i=0; i<keys.size(); i++)
+        sorted[i] = { keys[i], static_cast<uint16_t>(i) };
+    std::sort(sorted.begin(), sorted.end());
+
+    return sorted;
+}
+
+} // namespace detail
+
+} // namespace bits
+
+#endif /* BITS_LAYOUT_H */
@@ -0,0 +1,393 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <array>
+#include <span>
+#include <vector>
+#include <variant>
+#include <cstddef>
+
+#include <bits/Layout.h>
+#include <bits/BitsDeserializer.h>
+#include <bits/Enum.h>
+#include <bits/Flags.h>
+
+using ::testing::ElementsAreArray;
+
+template<typename T = std::byte, typename... Ts>
+constexpr std::array<T, sizeof...(Ts)> make_array(Ts && ... args) noexcept
+{
+    return { T(std::forward<Ts>(args))... };
+}
+
+BITS_DECLARE_ENUM_WITH_TYPE(Protocol, uint8_t,
+    ICMP, 1,
+    TCP,  6,
+    UDP,  17
+)
+
+BITS_DECLARE_FLAGS_WITH_TYPE(Fragments, uint8_t,
+    DONT_FRAGMENT,  1,
+    MORE_FRAGMENTS, 2
+)
+
+struct IpHeader
+{
+    uint8_t version;
+    uint8_t ihl;
+    uint8_t tos;
+    uint16_t length;
+    uint16_t identification;
+    FlagsFragments flags;
+    uint16_t fragmentOffset;
+    uint8_t ttl;
+    Protocol protocol;
+    uint16_t checksum;
+    std::array<uint8_t, 4> source;
+    std::array<uint8_t, 4> destination;
+};
+
+using IpHeaderLayout = bits::Layout<
+    bits::Field<&IpHeader::version, 4>,
+    bits::Field<&IpHeader::ihl, 4>,
+    bits::Field<&IpHeader::tos>,
+    bits::Field<&IpHeader::length>,
+    bits::Field<&IpHeader::identification>,
+    bits::Field<&IpHeader::flags, 3>,
+    bits::Field<&IpHeader::fragmentOffset, 13>,
+    bits::Field<&IpHeader::ttl>,
+    bits::Field<&IpHeader::protocol>,
+    bits::Field<&IpHeader::checksum>,
+    bits::Field<&IpHeader::source>,
+    bits::Field<&IpHeader::destination>
+>;
+
+constexpr auto IP_HEADER = make_array(
+    0x45, 0x00, 0x00, 0x3C, 0x1C, 0x46, 0x40, 0x00, 0x40, 0x06, 0xB1, 0xE6,
+    0xC0, 0xA8, 0x00, 0x68, 0xC0, 0xA8, 0x00, 0x01
+);
+
+//-----------------------------------------------------------------------------
+//- Layout tests
+//-----------------------------------------------------------------------------
+TEST(Layout, Size)
+{
+    static_assert(IpHeaderLayout::nb_bits == 160);
+    static_assert(IpHeaderLayout::nb_bytes == 20);
+    static_assert(std::is_same_v<IpHeaderLayout::message_type, IpHeader>);
+}
+
+TEST(Layout, Decode)
+{
+    const auto ipHeader = IpHeaderLayout::decode(IP_HEADER);
+
+    ASSERT_EQ(ipHeader.version, 4);
+    ASSERT_EQ(ipHeader.ihl, 5);
+    ASSERT_EQ(ipHeader.tos, 0);
+    ASSERT_EQ(ipHeader.length, 60);
+    ASSERT_EQ(ipHeader.identification, 0x1C46);
+    ASSERT_EQ(ipHeader.flags, Fragments::DONT_FRAGMENT);
+    ASSERT_EQ(ipHeader.fragmentOffset, 0);
+    ASSERT_EQ(ipHeader.ttl, 64);
+    ASSERT_EQ(ipHeader.protocol, Protocol::TCP);
+    ASSERT_EQ(ipHeader.checksum, 0xB1E6);
+    ASSERT_THAT(ipHeader.source, ElementsAreArray(make_array<uint8_t>(192, 168, 0, 104)));
+    ASSERT_THAT(ipHeader.destination, ElementsAreArray(make_array<uint8_t>(192, 168, 0, 1)));
+}
+
+TEST(Layout, Decode_ConstantEvaluated)
+{
+    static constexpr auto ipHeader = IpHeaderLayout::decode(IP_HEADER);
+
+    static_assert(ipHeader.length == 60);
+    static_assert(ipHeader.protocol == Protocol::TCP);
+    static_assert(ipHeader.destination[3] == 1);
+}
+
+TEST(Layout, Encode)
+{
+    const auto ipHeader = IpHeaderLayout::decode(IP_HEADER);
+    std::array<std::byte, IpHeaderLayout::nb_bytes> buffer = {};
+
+    IpHeaderLayout::encode(ipHeader, buffer);
+
+    ASSERT_THAT(buffer, ElementsAreArray(IP_HEADER));
+}
+
+TEST(Layout, Padding)
+{
+    struct Message
+    {
+        uint8_t  version;
+        uint16_t length;
+        bool     flag;
+    };
+    using MessageLayout = bits::Layout<
+        bits::Padding<2>,
+        bits::Field<&Message::version, 4>,
+        bits::Padding<6>,
+        bits::Field<&Message::length, 12>,
+        bits::Field<&Message::flag, 1>,
+        bits::Padding<7>
+    >;
+    static_assert(MessageLayout::nb_bytes == 4);
+
+    auto buffer = make_array(0xFF, 0xFF, 0xFF, 0xFF);
+    MessageLayout::encode({ 0x5, 0xABC, false }, buffer);
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0xD7, 0xFA, 0xBC, 0x7F)));
+
+    const auto message = MessageLayout::decode(buffer);
+    ASSERT_EQ(message.version, 0x5);
+    ASSERT_EQ(message.length, 0xABC);
+    ASSERT_EQ(message.flag, false);
+}
+
+//-----------------------------------------------------------------------------
+//- Layout views
+//-----------------------------------------------------------------------------
+TEST(Layout, View_Get)
+{
+    const auto header = IpHeaderLayout::view(IP_HEADER);
+
+    static_assert(std::is_same_v<decltype(header.bytes()), std::span<const std::byte>>);
+    ASSERT_EQ(header.get<&IpHeader::protocol>(), Protocol::TCP);
+    ASSERT_EQ(header.get<&IpHeader::flags>(), Fragments::DONT_FRAGMENT);
+    ASSERT_EQ(header.get<&IpHeader::fragmentOffset>(), 0);
+    ASSERT_THAT(header.get<&IpHeader::source>(), ElementsAreArray(make_array<uint8_t>(192, 168, 0, 104)));
+    ASSERT_EQ(header.decode().checksum, 0xB1E6);
+    static_assert(IpHeaderLayout::get<&IpHeader::length>(IP_HEADER) == 60);
+}
+
+TEST(Layout, View_Set)
+{
+    auto buffer = IP_HEADER;
+    const auto header = IpHeaderLayout::view(buffer);
+
+    header.set<&IpHeader::ihl>(6);
+    header.set<&IpHeader::ttl>(0x20);
+    header.set<&IpHeader::fragmentOffset>(0x1ABC);
+    header.set<&IpHeader::destination>({ 10, 0, 0, 1 });
+
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(
+        0x46, 0x00, 0x00, 0x3C, 0x1C, 0x46, 0x5A, 0xBC, 0x20, 0x06, 0xB1, 0xE6,
+        0xC0, 0xA8, 0x00, 0x68, 0x0A, 0x00, 0x00, 0x01
+    )));
+    ASSERT_EQ(header.get<&IpHeader::flags>(), Fragments::DONT_FRAGMENT);
+    ASSERT_EQ(header.get<&IpHeader::fragmentOffset>(), 0x1ABC);
+}
+
+//-----------------------------------------------------------------------------
+//- Variant fields
+//-----------------------------------------------------------------------------
+BITS_DECLARE_ENUM_WITH_TYPE(EtherType, uint16_t,
+    IP,   0x0800,
+    VLAN, 0x8100,
+    IPV6, 0x86DD
+)
+
+struct VlanTag
+{
+    uint8_t priority;
+    uint16_t identifier;
+    EtherType etherType;
+    std::variant<std::monostate, IpHeader> payload;
+};
+
+using VlanTagLayout = bits::Layout<
+    bits::Field<&VlanTag::priority, 3>,
+    bits::Padding<1>,
+    bits::Field<&VlanTag::identifier, 12>,
+    bits::Field<&VlanTag::etherType>,
+    bits::Variant<&VlanTag::etherType, &VlanTag::payload, bits::Case<EtherType::IP, IpHeaderLayout>>
+>;
+
+struct Frame
+{
+    std::array<uint8_t, 6> destination;
+    EtherType etherType;
+    std::variant<std::monostate, IpHeader, VlanTag> payload;
+};
+
+using FrameVariant = bits::Variant<&Frame::etherType, &Frame::payload,
+    bits::Case<EtherType::IP,   IpHeaderLayout>,
+    bits::Case<EtherType::VLAN, VlanTagLayout>
+>;
+using FrameLayout = bits::Layout<
+    bits::Field<&Frame::destination>,
+    bits::Field<&Frame::etherType>,
+    FrameVariant
+>;
+
+struct Icmp
+{
+    uint8_t type;
+    uint8_t code;
+};
+
+struct Udp
+{
+    uint16_t sourcePort;
+    uint16_t destinationPort;
+};
+
+struct Transport
+{
+    Protocol protocol;
+    std::variant<std::monostate, Icmp, Udp> payload;
+};
+
+using TransportVariant = bits::Variant<&Transport::protocol, &Transport::payload,
+    bits::Case<Protocol::UDP,  bits::Layout<bits::Field<&Udp::sourcePort>, bits::Field<&Udp::destinationPort>>>,
+    bits::Case<Protocol::ICMP, bits::Layout<bits::Field<&Icmp::type>, bits::Field<&Icmp::code>>>
+>;
+using TransportLayout = bits::Layout<bits::Field<&Transport::protocol>, TransportVariant>;
+
+std::vector<std::byte> make_frame(std::initializer_list<uint8_t> header)
+{
+    std::vector<std::byte> frame = { std::byte(0x01), std::byte(0x02), std::byte(0x03), std::byte(0x04), std::byte(0x05), std::byte(0x06) };
+
+    for(auto byte : header)
+        frame.push_back(std::byte(byte));
+    frame.insert(frame.end(), IP_HEADER.begin(), IP_HEADER.end());
+
+    return frame;
+}
+
+TEST(Layout, Variant_Decode)
+{
+    const auto buffer = make_frame({ 0x08, 0x00 });
+    const auto frame = FrameLayout::decode(buffer);
+
+    static_assert(FrameLayout::nb_bytes == 8);
+    ASSERT_EQ(frame.etherType, EtherType::IP);
+    ASSERT_TRUE(std::holds_alternative<IpHeader>(frame.payload));
+    ASSERT_EQ(std::get<IpHeader>(frame.payload).protocol, Protocol::TCP);
+    ASSERT_EQ(std::get<IpHeader>(frame.payload).length, 60);
+    ASSERT_EQ(FrameLayout::size(frame), 28u);
+}
+
+TEST(Layout, Variant_Nested)
+{
+    const auto buffer = make_frame({ 0x81, 0x00, 0xA1, 0x23, 0x08, 0x00 });
+    const auto frame = FrameLayout::decode(buffer);
+
+    ASSERT_TRUE(std::holds_alternative<VlanTag>(frame.payload));
+    const auto & vlanTag = std::get<VlanTag>(frame.payload);
+    ASSERT_EQ(vlanTag.priority, 5);
+    ASSERT_EQ(vlanTag.identifier, 0x123);
+    ASSERT_TRUE(std::holds_alternative<IpHeader>(vlanTag.payload));
+    ASSERT_THAT(std::get<IpHeader>(vlanTag.payload).destination, ElementsAreArray(make_array<uint8_t>(192, 168, 0, 1)));
+    ASSERT_EQ(FrameLayout::size(frame), buffer.size());
+}
+
+TEST(Layout, Variant_NoCase)
+{
+    auto frame = FrameLayout::decode(make_frame({ 0x86, 0xDD }));
+
+    ASSERT_EQ(frame.etherType, EtherType::IPV6);
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(frame.payload));
+    ASSERT_EQ(FrameLayout::size(frame), 8u);
+
+    FrameLayout::decode(make_frame({ 0x08, 0x00 }), frame);
+    FrameLayout::decode(make_frame({ 0x12, 0x34 }), frame);
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(frame.payload));
+}
+
+TEST(Layout, Variant_Encode)
+{
+    const auto expected = make_frame({ 0x81, 0x00, 0xA1, 0x23, 0x08, 0x00 });
+    const auto frame = FrameLayout::decode(expected);
+    std::vector<std::byte> buffer(FrameLayout::size(frame));
+
+    FrameLayout::encode(frame, buffer);
+    ASSERT_THAT(buffer, ElementsAreArray(expected));
+}
+
+TEST(Layout, Variant_Dispatch)
+{
+    static_assert(TransportVariant::dense_dispatch);
+    static_assert(not FrameVariant::dense_dispatch);
+
+    const auto icmp = TransportLayout::decode(make_array(0x01, 0x08, 0x00));
+    ASSERT_TRUE(std::holds_alternative<Icmp>(icmp.payload));
+    ASSERT_EQ(std::get<Icmp>(icmp.payload).type, 8);
+
+    const auto udp = TransportLayout::decode(make_array(0x11, 0x12, 0x34, 0x56, 0x78));
+    ASSERT_TRUE(std::holds_alternative<Udp>(udp.payload));
+    ASSERT_EQ(std::get<Udp>(udp.payload).sourcePort, 0x1234);
+    ASSERT_EQ(std::get<Udp>(udp.payload).destinationPort, 0x5678);
+
+    const auto tcp = TransportLayout::decode(make_array(0x06));
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(tcp.payload));
+
+    const auto outOfRange = TransportLayout::decode(make_array(0xFF));
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(outOfRange.payload));
+}
+
+//-----------------------------------------------------------------------------
+//- Layout should decode the same values as the deserializer, for every bits
+//- order
+//-----------------------------------------------------------------------------
+struct Message
+{
+    uint8_t  val1;
+    int16_t  val2;
+    uint32_t val3;
+    std::array<uint8_t, 3> val4;
+    int64_t  val5;
+};
+
+template<bits::detail::bits_order Order>
+void checkSameAsDeserializer(void)
+{
+    constexpr bool wholeBytes = Order::swap_bytes;
+    constexpr size_t nbBits1 = wholeBytes ? 8 : 3;
+    constexpr size_t nbBits2 = wholeBytes ? 16 : 13;
+    constexpr size_t nbBits3 = wholeBytes ? 24 : 29;
+    constexpr size_t nbBits4 = wholeBytes ? 8 : 5;
+    constexpr size_t nbBits5 = wholeBytes ? 40 : 47;
+
+    using MessageLayout = bits::BasicLayout<Order,
+        bits::Field<&Message::val1, nbBits1>,
+        bits::Field<&Message::val2, nbBits2>,
+        bits::Padding<wholeBytes ? 8 : 1>,
+        bits::Field<&Message::val3, nbBits3>,
+        bits::Field<&Message::val4, nbBits4>,
+        bits::Field<&Message::val5, nbBits5>
+    >;
+
+    std::array<std::byte, 16> buffer = {};
+    for(size_t i=0; i<buffer.size(); i++)
+        buffer[i] = std::byte((i * 0x9D + 0x35) ^ (i >> 2));
+
+    const auto message = MessageLayout::decode(buffer);
+    bits::BasicBitsDeserializer<Order> deserializer(buffer);
+    Message expected = {};
+
+    deserializer.extract(expected.val1, nbBits1).extract(expected.val2, nbBits2).skip(wholeBytes ? 8 : 1);
+    deserializer.extract(expected.val3, nbBits3).extract(expected.val4, nbBits4).extract(expected.val5, nbBits5);
+
+    ASSERT_EQ(message.val1, expected.val1);
+    ASSERT_EQ(message.val2, expected.val2);
+    ASSERT_EQ(message.val3, expected.val3);
+    ASSERT_THAT(message.val4, ElementsAreArray(expected.val4));
+    ASSERT_EQ(message.val5, expected.val5);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), MessageLayout::nb_bits);
+
+    std::array<std::byte, 16> encoded = buffer;
+    MessageLayout::encode(message, encoded);
+    ASSERT_THAT(encoded, ElementsAreArray(buffer));
+}
+
+TEST(Layout, SameAsDeserializer)
+{
+    checkSameAsDeserializer<bits::MsbFirstBigEndian>();
+    checkSameAsDeserializer<bits::MsbFirstLittleEndian>();
+    checkSameAsDeserializer<bits::LsbFirstLittleEndian>();
+    checkSameAsDeserializer<bits::LsbFirstBigEndian>();
+}
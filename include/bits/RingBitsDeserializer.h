@@ -0,0 +1,222 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_RING_BITS_DESERIALIZER_H
+#define BITS_RING_BITS_DESERIALIZER_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <climits>
+#include <array>
+#include <ranges>
+#include <span>
+
+#include <bits/bits_extraction.h>
+#include <bits/BitsOrder.h>
+#include <bits/BoundsCheck.h>
+#include <bits/detail/Traits.h>
+#include <bits/detail/BitsStream.h>
+#include <bits/detail/ring_buffer.h>
+#include <bits/detail/word_access.h>
+
+namespace bits {
+
+//-----------------------------------------------------------------------------
+//- Ring bits deserializer class : extractions from a ring (circular) buffer,
+//- starting at its head byte and wrapping past its end, without copying the
+//- message into a linear buffer.
+//-
+//- Fields and ranges not wrapping are extracted in place with the usual
+//- kernels. Fields wrapping are gathered into a small local buffer first,
+//- and ranges wrapping are extracted element by element.
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds = DefaultBoundsCheck>
+class BasicRingBitsDeserializer : public detail::BitsStream<BasicRingBitsDeserializer<Order, Bounds>, Bounds>
+{
+public:
+    inline BasicRingBitsDeserializer(const std::span<const std::byte> ring, size_t head, size_t initialOffsetBits = 0);
+
+    template<detail::output_basic_type T>
+    inline T extract(size_t nbBits = sizeof(T) * CHAR_BIT);
+    template<detail::output_basic_type T>
+    inline BasicRingBitsDeserializer & extract(T & val, size_t nbBits = sizeof(T) * CHAR_BIT);
+    template<detail::output_range R>
+    inline BasicRingBitsDeserializer & extract(R && r, size_t nbBits = sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
+
+    template<detail::output_basic_type T>
+    inline T peek(size_t nbBits = sizeof(T) * CHAR_BIT);
+
+protected:
+    using Base = detail::BitsStream<BasicRingBitsDeserializer<Order, Bounds>, Bounds>;
+    using Base::checkNbRemainingBits;
+    using Base::lengthBits;
+    using Base::posBits;
+    using Base::nbBitsNext;
+
+    template<typename T> inline void extractField(T & val, size_t nbBits);
+
+    const std::span<const std::byte> ring;
+    const size_t headBits;
+};
+
+using RingBitsDeserializer = BasicRingBitsDeserializer<DefaultBitsOrder>;
+
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::output_basic_type T>
+inline BasicRingBitsDeserializer<Order, Bounds> & operator >>(BasicRingBitsDeserializer<Order, Bounds> & bs, T & val);
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::output_range R>
+inline BasicRingBitsDeserializer<Order, Bounds> & operator >>(BasicRingBitsDeserializer<Order, Bounds> & bs, R && r);
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicRingBitsDeserializer<Order, Bounds> & operator >>(BasicRingBitsDeserializer<Order, Bounds> & bs, const detail::BitsStreamManipulation manip);
+
+
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicRingBitsDeserializer<Order, Bounds>::BasicRingBitsDeserializer(const std::span<const std::byte> ring_, size_t head, size_t initialOffsetBits)
+: Base(ring_.size() * CHAR_BIT, initialOffsetBits), ring(ring_), headBits(head * CHAR_BIT)
+{
+    Base::checkBounds(head < ring.size() or ring.empty(), "Ring head outside of the ring");
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<detail::output_basic_type T>
+inline T BasicRingBitsDeserializer<Order, Bounds>::extract(size_t nbBits)
+{
+    if(not checkNbRemainingBits(nbBits, "Unable to extract bits, too few bits remaining"))
+        return {};
+
+    T val = {};
+    extractField(val, nbBits);
+    posBits += nbBits;
+
+    return val;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<detail::output_basic_type T>
+inline BasicRingBitsDeserializer<Order, Bounds> & BasicRingBitsDeserializer<Order, Bounds>::extract(T & val, size_t nbBits)
+{
+    auto nbBitsToExtract = nbBitsNext ? nbBitsNext : nbBits;
+    if(not checkNbRemainingBits(nbBitsToExtract, "Unable to extract bits, too few bits remaining"))
+        return *this;
+
+    extractField(val, nbBitsToExtract);
+    posBits += nbBitsToExtract;
+    nbBitsNext = 0;
+
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<detail::output_range R>
+inline BasicRingBitsDeserializer<Order, Bounds> & BasicRingBitsDeserializer<Order, Bounds>::extract(R && r, size_t nbBits)
+{
+    auto nbBitsToExtractByElement = nbBitsNext ? nbBitsNext : nbBits;
+    auto nbBitsToExtract = nbBitsToExtractByElement * detail::range_size(std::forward<R>(r));
+    if(not checkNbRemainingBits(nbBitsToExtract, "Unable to extract bits, too few bits remaining"))
+        return *this;
+
+    const auto ringPosBits = detail::ring_position(lengthBits, headBits, posBits);
+
+    if(nbBitsToExtract > 0 and not detail::ring_wraps(lengthBits, ringPosBits, nbBitsToExtract))
+    {
+        bits::extract(Order{}, ring, std::forward<R>(r), ringPosBits + nbBitsToExtract - 1, ringPosBits, nbBitsToExtractByElement);
+        posBits += nbBitsToExtract;
+    }
+    else
+    {
+        for(auto & element : r)
+        {
+            extractField(element, nbBitsToExtractByElement);
+            posBits += nbBitsToExtractByElement;
+        }
+    }
+
+    nbBitsNext = 0;
+
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+//- Extract the next bits without moving the position (lookahead)
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<detail::output_basic_type T>
+inline T BasicRingBitsDeserializer<Order, Bounds>::peek(size_t nbBits)
+{
+    if(not checkNbRemainingBits(nbBits, "Unable to peek bits, too few bits remaining"))
+        return {};
+
+    T val = {};
+    extractField(val, nbBits);
+
+    return val;
+}
+
+//-----------------------------------------------------------------------------
+//- Fields wrapping are gathered into a local buffer, starting with the byte
+//- of the field first bit (the buffer being padded with a whole word, for the
+//- word loads of the extraction kernel)
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<typename T>
+inline void BasicRingBitsDeserializer<Order, Bounds>::extractField(T & val, size_t nbBits)
+{
+    if(nbBits == 0)
+        return;
+
+    const auto ringPosBits = detail::ring_position(lengthBits, headBits, posBits);
+
+    if(not detail::ring_wraps(lengthBits, ringPosBits, nbBits))
+    {
+        bits::extract(Order{}, ring, val, ringPosBits + nbBits - 1, ringPosBits);
+        return;
+    }
+
+    std::array<std::byte, sizeof(T) + detail::WORD_BYTES> gathered = {};
+    const auto firstBit = ringPosBits % CHAR_BIT;
+    const auto nbBytes  = (firstBit + nbBits + CHAR_BIT - 1) / CHAR_BIT;
+
+    detail::ring_gather(ring, ringPosBits / CHAR_BIT, std::span<std::byte>(gathered.data(), nbBytes));
+    bits::extract(Order{}, std::span<const std::byte>(gathered), val, firstBit + nbBits - 1, firstBit);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::output_basic_type T>
+inline BasicRingBitsDeserializer<Order, Bounds> & operator >>(BasicRingBitsDeserializer<Order, Bounds> & bs, T & val)
+{
+    return bs.extract(val, sizeof(T) * CHAR_BIT);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::output_range R>
+inline BasicRingBitsDeserializer<Order, Bounds> & operator >>(BasicRingBitsDeserializer<Order, Bounds> & bs, R && r)
+{
+    return bs.extract(std::forward<R>(r), sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicRingBitsDeserializer<Order, Bounds> & operator >>(BasicRingBitsDeserializer<Order, Bounds> & bs, detail::BitsStreamManipulation manip)
+{
+    bs.setManipulation(manip);
+    return bs;
+}
+
+} // namespace bits
+
+#endif /* BITS_RING_BITS_DESERIALIZER_H */
@@ -0,0 +1,215 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <array>
+#include <span>
+#include <tuple>
+#include <vector>
+#include <cstddef>
+
+#include <bits/RingBitsDeserializer.h>
+#include <bits/BitsDeserializer.h>
+#include <bits/Uint.h>
+
+using ::testing::ElementsAreArray;
+
+template<typename T = std::byte, typename... Ts>
+constexpr std::array<const T, sizeof...(Ts)> make_array(Ts && ... args) noexcept
+{
+    return { T(std::forward<Ts>(args))... };
+}
+
+//-----------------------------------------------------------------------------
+//- Ring holding a message starting at the given head, and wrapping past the
+//- ring end
+//-----------------------------------------------------------------------------
+template<typename Message>
+std::array<std::byte, std::tuple_size_v<Message>> make_ring(const Message & message, size_t head)
+{
+    std::array<std::byte, std::tuple_size_v<Message>> ring = {};
+
+    for(size_t i=0; i<ring.size(); i++)
+        ring[(head + i) % ring.size()] = message[i];
+
+    return ring;
+}
+
+const auto MESSAGE = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+//-----------------------------------------------------------------------------
+//- Ring deserializer / Deserializer common tests
+//-----------------------------------------------------------------------------
+TEST(RingBitsDeserializer, OutOfRange)
+{
+    const auto ring = make_ring(MESSAGE, 11);
+    bits::RingBitsDeserializer deserializer(ring, 11);
+
+    ASSERT_THROW(deserializer.skip(256), std::out_of_range);
+    ASSERT_THROW(deserializer.extract<uint8_t>(129), std::out_of_range);
+    ASSERT_THROW(bits::RingBitsDeserializer(ring, 16), std::out_of_range);
+}
+
+TEST(RingBitsDeserializer, ChainedExtract)
+{
+    const auto ring = make_ring(MESSAGE, 14);
+    bits::RingBitsDeserializer deserializer(ring, 14);
+    uint8_t val1 = 0;
+    uint8_t val2 = 0;
+    uint8_t val3 = 0;
+    uint8_t val4 = 0;
+    uint8_t val5 = 0;
+
+    deserializer
+        .extract(val1, 4)
+        .extract(val2, 2)
+        .extract(val3, 8)
+        .extract(val4, 8)
+        .extract(val5, 8)
+    ;
+
+    ASSERT_EQ(val1, 0x03);
+    ASSERT_EQ(val2, 0x01);
+    ASSERT_EQ(val3, 0x7F);
+    ASSERT_EQ(val4, 0xDC);
+    ASSERT_EQ(val5, 0x0D);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 30);
+}
+
+TEST(RingBitsDeserializer, BitsManipulation_SkipAndReset)
+{
+    const auto ring = make_ring(MESSAGE, 9);
+    bits::RingBitsDeserializer deserializer(ring, 9);
+    uint16_t val1 = 0;
+    uint16_t val2 = 0;
+    uint16_t val3 = 0;
+
+    deserializer >> bits::skip(76) >> val1 >> bits::reset() >> bits::skip(12) >> val2 >> bits::reset() >> bits::skip(76) >> val3;
+
+    ASSERT_EQ(val1, 0xEBAB);
+    ASSERT_EQ(val2, 0xF703);
+    ASSERT_EQ(val3, 0xEBAB);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 92);
+}
+
+//-----------------------------------------------------------------------------
+//- RingBitsDeserializer specific tests
+//-----------------------------------------------------------------------------
+TEST(RingBitsDeserializer, Fields_Wrapping)
+{
+    const auto ring = make_ring(MESSAGE, 6);
+    bits::RingBitsDeserializer deserializer(ring, 6, 4);
+
+    ASSERT_EQ(deserializer.extract<uint16_t>(16), 0x5FF7);
+    ASSERT_EQ(deserializer.extract<uint64_t>(), 0x035FF703'5FFCAFEBu);
+    ASSERT_EQ(deserializer.extract<int16_t>(12), -1'346);
+    ASSERT_EQ(deserializer.extract<uint32_t>(28), 0x0A5B6C7Du);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 120);
+}
+
+TEST(RingBitsDeserializer, PeekAndSeek)
+{
+    const auto ring = make_ring(MESSAGE, 14);
+    bits::RingBitsDeserializer deserializer(ring, 14);
+
+    deserializer.skip(12);
+    ASSERT_EQ(deserializer.peek<uint16_t>(), 0xF703);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 12);
+
+    deserializer.seek(120);
+    ASSERT_EQ(deserializer.peek<uint8_t>(), 0xD8);
+    deserializer.seek(12);
+    ASSERT_EQ(deserializer.extract<uint16_t>(), 0xF703);
+}
+
+TEST(RingBitsDeserializer, Ranges)
+{
+    const auto ring = make_ring(MESSAGE, 13);
+    bits::RingBitsDeserializer deserializer(ring, 13, 4);
+    std::array<uint8_t, 3> array = {};
+    std::vector<uint8_t> vector(2, 0);
+    std::array<uint16_t, 4> inside = {};
+
+    deserializer >> array >> bits::nbits(4) >> vector >> bits::skip(4) >> inside;
+
+    ASSERT_THAT(array, ElementsAreArray(make_array<uint8_t>(0x5F, 0xF7, 0x03)));
+    ASSERT_THAT(vector, ElementsAreArray(make_array<uint8_t>(0x05, 0x0F)));
+    ASSERT_THAT(inside, ElementsAreArray(make_array<uint16_t>(0x7035, 0xFFCA, 0xFEBA, 0xBEA5)));
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 100);
+}
+
+TEST(RingBitsDeserializer, BitsOrder)
+{
+    const auto ring = make_ring(MESSAGE, 15);
+    bits::BasicRingBitsDeserializer<bits::LsbFirstLittleEndian> deserializer(ring, 15);
+    uint8_t val1 = 0;
+    uint8_t val2 = 0;
+    uint16_t val3 = 0;
+    uint32_t val4 = 0;
+
+    deserializer.extract(val1, 4).extract(val2, 4);
+    deserializer >> val3 >> val4;
+
+    ASSERT_EQ(val1, 0x05);
+    ASSERT_EQ(val2, 0x03);
+    ASSERT_EQ(val3, 0x70FF);
+    ASSERT_EQ(val4, 0x3570FF35u);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 56);
+}
+
+TEST(RingBitsDeserializer, Wide)
+{
+    const auto ring = make_ring(MESSAGE, 5);
+    bits::RingBitsDeserializer deserializer(ring, 5);
+    uint8_t val1 = 0;
+    bits::uint<96> val2;
+    bits::uint<24> val3;
+
+    deserializer >> val1 >> val2;
+    deserializer.extract(val3, 20);
+
+    ASSERT_EQ(val1, 0x35);
+    ASSERT_EQ(val2, bits::uint<96>(0xFF7035FF, 0x7035FFCAFEBABEA5));
+    ASSERT_EQ(val3, bits::uint<24>(0xB6C7D));
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 124);
+}
+
+//-----------------------------------------------------------------------------
+//- Chains of fields of every width (whole bytes for swapped bytes orders),
+//- for every head, should give the same values as the deserializer over the
+//- linear message
+//-----------------------------------------------------------------------------
+template<bits::detail::bits_order Order>
+void checkSameAsDeserializer(void)
+{
+    std::array<std::byte, 37> message = {};
+    for(size_t i=0; i<message.size(); i++)
+        message[i] = std::byte((i * 0x9D + 0x35) ^ (i >> 2));
+
+    const size_t step = Order::swap_bytes ? 8 : 1;
+
+    for(size_t head=0; head<message.size(); head++)
+    {
+        const auto ring = make_ring(message, head);
+        bits::BasicRingBitsDeserializer<Order> ringDeserializer(ring, head, 3);
+        bits::BasicBitsDeserializer<Order> deserializer(message, 3);
+
+        for(size_t nbBits=step; (ringDeserializer.nbBitsStreamed() + 3 + nbBits + step) <= (message.size() * CHAR_BIT); nbBits = (nbBits % 64) + step)
+        {
+            ASSERT_EQ(ringDeserializer.template extract<uint64_t>(nbBits), deserializer.template extract<uint64_t>(nbBits)) << "head = " << head << ", nbBits = " << nbBits;
+            ASSERT_EQ(ringDeserializer.template extract<int64_t>(step), deserializer.template extract<int64_t>(step));
+        }
+    }
+}
+
+TEST(RingBitsDeserializer, SameAsDeserializer)
+{
+    checkSameAsDeserializer<bits::MsbFirstBigEndian>();
+    checkSameAsDeserializer<bits::MsbFirstLittleEndian>();
+    checkSameAsDeserializer<bits::LsbFirstLittleEndian>();
+    checkSameAsDeserializer<bits::LsbFirstBigEndian>();
+}
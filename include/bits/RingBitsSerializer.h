@@ -0,0 +1,189 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_RING_BITS_SERIALIZER_H
+#define BITS_RING_BITS_SERIALIZER_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <climits>
+#include <array>
+#include <ranges>
+#include <span>
+
+#include <bits/bits_insertion.h>
+#include <bits/BitsOrder.h>
+#include <bits/BoundsCheck.h>
+#include <bits/detail/Traits.h>
+#include <bits/detail/BitsStream.h>
+#include <bits/detail/ring_buffer.h>
+#include <bits/detail/word_access.h>
+
+namespace bits {
+
+//-----------------------------------------------------------------------------
+//- Ring bits serializer class : insertions into a ring (circular) buffer,
+//- starting at its head byte and wrapping past its end, without serializing
+//- the message into a linear buffer first.
+//-
+//- Fields and ranges not wrapping are inserted in place with the usual
+//- kernels. Fields wrapping are inserted into a small local copy of the bytes
+//- they cover, written back to the ring, and ranges wrapping are inserted
+//- element by element.
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds = DefaultBoundsCheck>
+class BasicRingBitsSerializer : public detail::BitsStream<BasicRingBitsSerializer<Order, Bounds>, Bounds>
+{
+public:
+    inline BasicRingBitsSerializer(const std::span<std::byte> ring, size_t head, size_t initialOffsetBits = 0);
+
+    template<detail::input_basic_type T>
+    inline BasicRingBitsSerializer & insert(T val, size_t nbBits = sizeof(T) * CHAR_BIT);
+    template<std::ranges::input_range R>
+    inline BasicRingBitsSerializer & insert(R && r, size_t nbBits = sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
+
+protected:
+    using Base = detail::BitsStream<BasicRingBitsSerializer<Order, Bounds>, Bounds>;
+    using Base::checkNbRemainingBits;
+    using Base::lengthBits;
+    using Base::posBits;
+    using Base::nbBitsNext;
+
+    template<typename T> inline void insertField(T val, size_t nbBits);
+
+    const std::span<std::byte> ring;
+    const size_t headBits;
+};
+
+using RingBitsSerializer = BasicRingBitsSerializer<DefaultBitsOrder>;
+
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::input_basic_type T>
+inline BasicRingBitsSerializer<Order, Bounds> & operator <<(BasicRingBitsSerializer<Order, Bounds> & bs, T val);
+template<detail::bits_order Order, detail::bounds_check Bounds, std::ranges::input_range R>
+inline BasicRingBitsSerializer<Order, Bounds> & operator <<(BasicRingBitsSerializer<Order, Bounds> & bs, R && r);
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicRingBitsSerializer<Order, Bounds> & operator <<(BasicRingBitsSerializer<Order, Bounds> & bs, const detail::BitsStreamManipulation manip);
+
+
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicRingBitsSerializer<Order, Bounds>::BasicRingBitsSerializer(const std::span<std::byte> ring_, size_t head, size_t initialOffsetBits)
+: Base(ring_.size() * CHAR_BIT, initialOffsetBits), ring(ring_), headBits(head * CHAR_BIT)
+{
+    Base::checkBounds(head < ring.size() or ring.empty(), "Ring head outside of the ring");
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<detail::input_basic_type T>
+inline BasicRingBitsSerializer<Order, Bounds> & BasicRingBitsSerializer<Order, Bounds>::insert(T val, size_t nbBits)
+{
+    auto nbBitsToInsert = nbBitsNext ? nbBitsNext : nbBits;
+    if(not checkNbRemainingBits(nbBitsToInsert, "Unable to insert bits, too few bits remaining"))
+        return *this;
+
+    insertField(val, nbBitsToInsert);
+    posBits += nbBitsToInsert;
+    nbBitsNext = 0;
+
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<std::ranges::input_range R>
+inline BasicRingBitsSerializer<Order, Bounds> & BasicRingBitsSerializer<Order, Bounds>::insert(R && r, size_t nbBits)
+{
+    auto nbBitsToInsertByElement = nbBitsNext ? nbBitsNext : nbBits;
+    auto nbBitsToInsert = nbBitsToInsertByElement * detail::range_size(std::forward<R>(r));
+    if(not checkNbRemainingBits(nbBitsToInsert, "Unable to insert bits, too few bits remaining"))
+        return *this;
+
+    const auto ringPosBits = detail::ring_position(lengthBits, headBits, posBits);
+
+    if(nbBitsToInsert > 0 and not detail::ring_wraps(lengthBits, ringPosBits, nbBitsToInsert))
+    {
+        bits::insert(Order{}, ring, std::forward<R>(r), ringPosBits + nbBitsToInsert - 1, ringPosBits, nbBitsToInsertByElement);
+        posBits += nbBitsToInsert;
+    }
+    else
+    {
+        for(const auto & element : r)
+        {
+            insertField(element, nbBitsToInsertByElement);
+            posBits += nbBitsToInsertByElement;
+        }
+    }
+
+    nbBitsNext = 0;
+
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+//- Fields wrapping are inserted into a local copy of the bytes they cover,
+//- starting with the byte of the field first bit (as the stream starts on a
+//- byte boundary, a field never covers the same ring byte twice)
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<typename T>
+inline void BasicRingBitsSerializer<Order, Bounds>::insertField(T val, size_t nbBits)
+{
+    if(nbBits == 0)
+        return;
+
+    const auto ringPosBits = detail::ring_position(lengthBits, headBits, posBits);
+
+    if(not detail::ring_wraps(lengthBits, ringPosBits, nbBits))
+    {
+        bits::insert(Order{}, ring, val, ringPosBits + nbBits - 1, ringPosBits);
+        return;
+    }
+
+    std::array<std::byte, sizeof(T) + detail::WORD_BYTES> gathered = {};
+    const auto firstBit = ringPosBits % CHAR_BIT;
+    const auto nbBytes  = (firstBit + nbBits + CHAR_BIT - 1) / CHAR_BIT;
+    const auto bytes    = std::span<std::byte>(gathered.data(), nbBytes);
+
+    detail::ring_gather(ring, ringPosBits / CHAR_BIT, bytes);
+    bits::insert(Order{}, std::span<std::byte>(gathered), val, firstBit + nbBits - 1, firstBit);
+    detail::ring_scatter(ring, ringPosBits / CHAR_BIT, bytes);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::input_basic_type T>
+inline BasicRingBitsSerializer<Order, Bounds> & operator <<(BasicRingBitsSerializer<Order, Bounds> & bs, T val)
+{
+    return bs.insert(val);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds, std::ranges::input_range R>
+inline BasicRingBitsSerializer<Order, Bounds> & operator <<(BasicRingBitsSerializer<Order, Bounds> & bs, R && r)
+{
+    return bs.insert(std::forward<R>(r), sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicRingBitsSerializer<Order, Bounds> & operator <<(BasicRingBitsSerializer<Order, Bounds> & bs, const detail::BitsStreamManipulation manip)
+{
+    bs.setManipulation(manip);
+    return bs;
+}
+
+} // namespace bits
+
+#endif /* BITS_RING_BITS_SERIALIZER_H */
@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <array>
+#include <span>
+#include <tuple>
+#include <vector>
+#include <cstddef>
+
+#include <bits/RingBitsSerializer.h>
+#include <bits/BitsSerializer.h>
+#include <bits/Uint.h>
+
+using ::testing::ElementsAreArray;
+
+template<typename T = std::byte, typename... Ts>
+constexpr std::array<T, sizeof...(Ts)> make_array(Ts && ... args) noexcept
+{
+    return { T(std::forward<Ts>(args))... };
+}
+
+//-----------------------------------------------------------------------------
+//- Ring holding a message starting at the given head, and wrapping past the
+//- ring end
+//-----------------------------------------------------------------------------
+template<typename Message>
+std::array<std::byte, std::tuple_size_v<Message>> make_ring(const Message & message, size_t head)
+{
+    std::array<std::byte, std::tuple_size_v<Message>> ring = {};
+
+    for(size_t i=0; i<ring.size(); i++)
+        ring[(head + i) % ring.size()] = message[i];
+
+    return ring;
+}
+
+//-----------------------------------------------------------------------------
+//- Ring serializer / Serializer common tests
+//-----------------------------------------------------------------------------
+TEST(RingBitsSerializer, OutOfRange)
+{
+    std::array<std::byte, 8> ring = {};
+    bits::RingBitsSerializer serializer(ring, 5);
+
+    ASSERT_THROW(serializer.skip(128), std::out_of_range);
+    ASSERT_THROW(serializer.insert(uint8_t(0), 65), std::out_of_range);
+    ASSERT_THROW(bits::RingBitsSerializer(ring, 8), std::out_of_range);
+}
+
+TEST(RingBitsSerializer, ChainedInsert)
+{
+    std::array<std::byte, 8> ring = {};
+    bits::RingBitsSerializer serializer(ring, 6);
+
+    serializer
+        .insert(uint8_t { 0x03 }, 4)
+        .insert(uint8_t { 0x01 }, 2)
+        .insert(uint8_t { 0x7F }, 8)
+        .insert(uint8_t { 0xDC }, 8)
+        .insert(uint8_t { 0x0D }, 8)
+    ;
+
+    ASSERT_THAT(ring, ElementsAreArray(make_ring(make_array(0x35, 0xFF, 0x70, 0x34, 0x00, 0x00, 0x00, 0x00), 6)));
+    ASSERT_EQ(serializer.nbBitsStreamed(), 30);
+}
+
+TEST(RingBitsSerializer, BitsManipulation_SkipAndReset)
+{
+    auto ring = make_array(0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF);
+    bits::RingBitsSerializer serializer(ring, 2, 4);
+
+    serializer << bits::nbits(4) << uint8_t(0x0) << bits::skip(8) << bits::nbits(4) << uint8_t(0x0);
+    serializer << bits::reset() << bits::skip(24) << uint16_t(0x1234);
+    ASSERT_EQ(serializer.nbBitsStreamed(), 40);
+
+    ASSERT_THAT(ring, ElementsAreArray(make_ring(make_array(0xF0, 0xFF, 0x0F, 0xF1, 0x23, 0x4F, 0xFF, 0xFF), 2)));
+}
+
+//-----------------------------------------------------------------------------
+//- RingBitsSerializer specific tests
+//-----------------------------------------------------------------------------
+TEST(RingBitsSerializer, Fields_Wrapping)
+{
+    auto ring = make_array(0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF);
+    bits::RingBitsSerializer serializer(ring, 6, 4);
+
+    serializer.insert(uint16_t(0x5FF7), 16).insert(uint64_t(0x035FF703'5FFCAFEBu)).insert(int16_t(-1'346), 12).insert(uint32_t(0x0A5B6C7Du), 28);
+
+    ASSERT_THAT(ring, ElementsAreArray(make_ring(make_array(0xF5, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xDF), 6)));
+    ASSERT_EQ(serializer.nbBitsStreamed(), 120);
+}
+
+TEST(RingBitsSerializer, Ranges)
+{
+    auto ring = make_array(0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF);
+    bits::RingBitsSerializer serializer(ring, 1);
+    std::array<uint8_t, 3> array = { 0x5F, 0xF7, 0x03 };
+    std::array<uint16_t, 2> inside = { 0x1234, 0x5678 };
+
+    serializer << inside << bits::nbits(4) << uint8_t(0x0) << array << bits::nbits(4) << uint8_t(0x0);
+
+    ASSERT_THAT(ring, ElementsAreArray(make_ring(make_array(0x12, 0x34, 0x56, 0x78, 0x05, 0xFF, 0x70, 0x30), 1)));
+}
+
+TEST(RingBitsSerializer, BitsOrder)
+{
+    std::array<std::byte, 8> ring = {};
+    bits::BasicRingBitsSerializer<bits::LsbFirstLittleEndian> serializer(ring, 3);
+
+    serializer.insert(uint8_t(0x05), 4).insert(uint8_t(0x03), 4);
+    serializer << uint16_t(0x70FF) << uint32_t(0x3570FF35);
+
+    ASSERT_THAT(ring, ElementsAreArray(make_ring(make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0x00), 3)));
+    ASSERT_EQ(serializer.nbBitsStreamed(), 56);
+}
+
+TEST(RingBitsSerializer, Wide)
+{
+    std::array<std::byte, 16> ring = {};
+    bits::RingBitsSerializer serializer(ring, 5);
+
+    serializer << uint8_t(0x35) << bits::uint<96>(0xFF7035FF, 0x7035FFCAFEBABEA5);
+    serializer.insert(bits::uint<24>(0xB6C7D), 20);
+
+    ASSERT_THAT(ring, ElementsAreArray(make_ring(make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD0), 5)));
+    ASSERT_EQ(serializer.nbBitsStreamed(), 124);
+}
+
+//-----------------------------------------------------------------------------
+//- Chains of fields of every width (whole bytes for swapped bytes orders),
+//- for every head, should give the same message as the serializer into a
+//- linear buffer
+//-----------------------------------------------------------------------------
+template<bits::detail::bits_order Order>
+void checkSameAsSerializer(void)
+{
+    const size_t step = Order::swap_bytes ? 8 : 1;
+
+    for(size_t head=0; head<37; head++)
+    {
+        std::array<std::byte, 37> message = {};
+        message.fill(std::byte(0xA5));
+        auto ring = make_ring(message, head);
+
+        bits::BasicRingBitsSerializer<Order> ringSerializer(ring, head, 3);
+        bits::BasicBitsSerializer<Order> serializer(message, 3);
+
+        for(size_t nbBits=step, i=0; (ringSerializer.nbBitsStreamed() + 3 + nbBits + step) <= (message.size() * CHAR_BIT); nbBits = (nbBits % 64) + step, i++)
+        {
+            const uint64_t val = 0x9E37'79B9'7F4A'7C15u * (i + 1);
+            ringSerializer.insert(val, nbBits).insert(int64_t(-1), step);
+            serializer.insert(val, nbBits).insert(int64_t(-1), step);
+        }
+
+        ASSERT_THAT(ring, ElementsAreArray(make_ring(message, head))) << "head = " << head;
+    }
+}
+
+TEST(RingBitsSerializer, SameAsSerializer)
+{
+    checkSameAsSerializer<bits::MsbFirstBigEndian>();
+    checkSameAsSerializer<bits::MsbFirstLittleEndian>();
+    checkSameAsSerializer<bits::LsbFirstLittleEndian>();
+    checkSameAsSerializer<bits::LsbFirstBigEndian>();
+}
@@ -0,0 +1,270 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_SCATTER_BITS_DESERIALIZER_H
+#define BITS_SCATTER_BITS_DESERIALIZER_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <climits>
+#include <array>
+#include <ranges>
+#include <span>
+
+#include <bits/bits_extraction.h>
+#include <bits/BitsOrder.h>
+#include <bits/BoundsCheck.h>
+#include <bits/detail/Traits.h>
+#include <bits/detail/BitsStream.h>
+#include <bits/detail/word_access.h>
+
+namespace bits {
+
+//-----------------------------------------------------------------------------
+//- Scatter / gather bits deserializer class : extractions from a sequence of
+//- buffers (chunks), as if they were concatenated, without linearizing them.
+//-
+//- Fields inside a chunk are extracted from the chunk with the usual kernels.
+//- Fields spanning chunks boundaries are gathered into a small local buffer
+//- first. Ranges inside a chunk are extracted at once, and element by element
+//- otherwise.
+//-
+//- The chunks (and the sequence of chunks) aren't copied, so they should
+//- outlive the deserializer.
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds = DefaultBoundsCheck>
+class BasicScatterBitsDeserializer : public detail::BitsStream<BasicScatterBitsDeserializer<Order, Bounds>, Bounds>
+{
+public:
+    using Chunk = std::span<const std::byte>;
+
+    inline BasicScatterBitsDeserializer(const std::span<const Chunk> chunks, size_t initialOffsetBits = 0);
+
+    template<detail::output_basic_type T>
+    inline T extract(size_t nbBits = sizeof(T) * CHAR_BIT);
+    template<detail::output_basic_type T>
+    inline BasicScatterBitsDeserializer & extract(T & val, size_t nbBits = sizeof(T) * CHAR_BIT);
+    template<detail::output_range R>
+    inline BasicScatterBitsDeserializer & extract(R && r, size_t nbBits = sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
+
+    template<detail::output_basic_type T>
+    inline T peek(size_t nbBits = sizeof(T) * CHAR_BIT);
+
+protected:
+    using Base = detail::BitsStream<BasicScatterBitsDeserializer<Order, Bounds>, Bounds>;
+    using Base::checkNbRemainingBits;
+    using Base::posBits;
+    using Base::nbBitsNext;
+
+    static inline size_t totalSize(const std::span<const Chunk> chunks) noexcept;
+
+    inline bool locate(size_t nbBits) noexcept;
+    template<typename T> inline void extractField(T & val, size_t nbBits);
+
+    const std::span<const Chunk> chunks;
+
+    size_t chunkIndex;
+    size_t chunkStartBits;
+};
+
+using ScatterBitsDeserializer = BasicScatterBitsDeserializer<DefaultBitsOrder>;
+
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::output_basic_type T>
+inline BasicScatterBitsDeserializer<Order, Bounds> & operator >>(BasicScatterBitsDeserializer<Order, Bounds> & bs, T & val);
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::output_range R>
+inline BasicScatterBitsDeserializer<Order, Bounds> & operator >>(BasicScatterBitsDeserializer<Order, Bounds> & bs, R && r);
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicScatterBitsDeserializer<Order, Bounds> & operator >>(BasicScatterBitsDeserializer<Order, Bounds> & bs, const detail::BitsStreamManipulation manip);
+
+
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicScatterBitsDeserializer<Order, Bounds>::BasicScatterBitsDeserializer(const std::span<const Chunk> chunks_, size_t initialOffsetBits)
+: Base(totalSize(chunks_) * CHAR_BIT, initialOffsetBits), chunks(chunks_), chunkIndex(0), chunkStartBits(0)
+{}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<detail::output_basic_type T>
+inline T BasicScatterBitsDeserializer<Order, Bounds>::extract(size_t nbBits)
+{
+    if(not checkNbRemainingBits(nbBits, "Unable to extract bits, too few bits remaining"))
+        return {};
+
+    T val = {};
+    extractField(val, nbBits);
+    posBits += nbBits;
+
+    return val;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<detail::output_basic_type T>
+inline BasicScatterBitsDeserializer<Order, Bounds> & BasicScatterBitsDeserializer<Order, Bounds>::extract(T & val, size_t nbBits)
+{
+    auto nbBitsToExtract = nbBitsNext ? nbBitsNext : nbBits;
+    if(not checkNbRemainingBits(nbBitsToExtract, "Unable to extract bits, too few bits remaining"))
+        return *this;
+
+    extractField(val, nbBitsToExtract);
+    posBits += nbBitsToExtract;
+    nbBitsNext = 0;
+
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<detail::output_range R>
+inline BasicScatterBitsDeserializer<Order, Bounds> & BasicScatterBitsDeserializer<Order, Bounds>::extract(R && r, size_t nbBits)
+{
+    auto nbBitsToExtractByElement = nbBitsNext ? nbBitsNext : nbBits;
+    auto nbBitsToExtract = nbBitsToExtractByElement * detail::range_size(std::forward<R>(r));
+    if(not checkNbRemainingBits(nbBitsToExtract, "Unable to extract bits, too few bits remaining"))
+        return *this;
+
+    if(nbBitsToExtract > 0 and locate(nbBitsToExtract))
+    {
+        const auto pos = posBits - chunkStartBits;
+        bits::extract(Order{}, chunks[chunkIndex], std::forward<R>(r), pos + nbBitsToExtract - 1, pos, nbBitsToExtractByElement);
+        posBits += nbBitsToExtract;
+    }
+    else
+    {
+        for(auto & element : r)
+        {
+            extractField(element, nbBitsToExtractByElement);
+            posBits += nbBitsToExtractByElement;
+        }
+    }
+
+    nbBitsNext = 0;
+
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+//- Extract the next bits without moving the position (lookahead)
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<detail::output_basic_type T>
+inline T BasicScatterBitsDeserializer<Order, Bounds>::peek(size_t nbBits)
+{
+    if(not checkNbRemainingBits(nbBits, "Unable to peek bits, too few bits remaining"))
+        return {};
+
+    T val = {};
+    extractField(val, nbBits);
+
+    return val;
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline size_t BasicScatterBitsDeserializer<Order, Bounds>::totalSize(const std::span<const Chunk> chunks) noexcept
+{
+    size_t size = 0;
+
+    for(const auto & chunk : chunks)
+        size += chunk.size();
+
+    return size;
+}
+
+//-----------------------------------------------------------------------------
+//- Move to the chunk of the current position (forward from the current chunk,
+//- or from the first one when moving backward), and tell if the next 'nbBits'
+//- bits are inside this chunk
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline bool BasicScatterBitsDeserializer<Order, Bounds>::locate(size_t nbBits) noexcept
+{
+    if(posBits < chunkStartBits)
+    {
+        chunkIndex = 0;
+        chunkStartBits = 0;
+    }
+
+    while(chunkIndex < chunks.size() and posBits >= (chunkStartBits + chunks[chunkIndex].size() * CHAR_BIT))
+        chunkStartBits += chunks[chunkIndex++].size() * CHAR_BIT;
+
+    return chunkIndex < chunks.size() and (posBits + nbBits) <= (chunkStartBits + chunks[chunkIndex].size() * CHAR_BIT);
+}
+
+//-----------------------------------------------------------------------------
+//- Fields spanning chunks boundaries are gathered from the chunks into a local
+//- buffer, starting with the byte of the field first bit (the buffer being
+//- padded with a whole word, for the word loads of the extraction kernel)
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+template<typename T>
+inline void BasicScatterBitsDeserializer<Order, Bounds>::extractField(T & val, size_t nbBits)
+{
+    if(nbBits == 0)
+        return;
+
+    if(locate(nbBits))
+    {
+        const auto pos = posBits - chunkStartBits;
+        bits::extract(Order{}, chunks[chunkIndex], val, pos + nbBits - 1, pos);
+        return;
+    }
+
+    std::array<std::byte, sizeof(T) + detail::WORD_BYTES> gathered = {};
+    const auto firstBit = posBits % CHAR_BIT;
+    const auto nbBytes  = (firstBit + nbBits + CHAR_BIT - 1) / CHAR_BIT;
+
+    auto index = chunkIndex;
+    auto offset = posBits / CHAR_BIT - chunkStartBits / CHAR_BIT;
+    for(size_t i=0; i<nbBytes and index < chunks.size(); )
+    {
+        if(offset < chunks[index].size())
+            gathered[i++] = chunks[index][offset++];
+        else
+        {
+            index++;
+            offset = 0;
+        }
+    }
+
+    bits::extract(Order{}, std::span<const std::byte>(gathered), val, firstBit + nbBits - 1, firstBit);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::output_basic_type T>
+inline BasicScatterBitsDeserializer<Order, Bounds> & operator >>(BasicScatterBitsDeserializer<Order, Bounds> & bs, T & val)
+{
+    return bs.extract(val, sizeof(T) * CHAR_BIT);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds, detail::output_range R>
+inline BasicScatterBitsDeserializer<Order, Bounds> & operator >>(BasicScatterBitsDeserializer<Order, Bounds> & bs, R && r)
+{
+    return bs.extract(std::forward<R>(r), sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::bounds_check Bounds>
+inline BasicScatterBitsDeserializer<Order, Bounds> & operator >>(BasicScatterBitsDeserializer<Order, Bounds> & bs, detail::BitsStreamManipulation manip)
+{
+    bs.setManipulation(manip);
+    return bs;
+}
+
+} // namespace bits
+
+#endif /* BITS_SCATTER_BITS_DESERIALIZER_H */
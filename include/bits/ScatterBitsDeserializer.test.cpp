@@ -0,0 +1,212 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <array>
+#include <span>
+#include <vector>
+#include <cstddef>
+
+#include <bits/ScatterBitsDeserializer.h>
+#include <bits/BitsDeserializer.h>
+#include <bits/Uint.h>
+
+using ::testing::ElementsAreArray;
+using Chunk = std::span<const std::byte>;
+
+template<typename T = std::byte, typename... Ts>
+constexpr std::array<const T, sizeof...(Ts)> make_array(Ts && ... args) noexcept
+{
+    return { T(std::forward<Ts>(args))... };
+}
+
+//-----------------------------------------------------------------------------
+//- Split a buffer into chunks of the given sizes (the last chunk having the
+//- remaining bytes)
+//-----------------------------------------------------------------------------
+std::vector<Chunk> split(const std::span<const std::byte> buffer, std::initializer_list<size_t> sizes)
+{
+    std::vector<Chunk> chunks;
+    size_t offset = 0;
+
+    for(auto size : sizes)
+    {
+        chunks.push_back(buffer.subspan(offset, size));
+        offset += size;
+    }
+    chunks.push_back(buffer.subspan(offset));
+
+    return chunks;
+}
+
+const auto BUFFER = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+//-----------------------------------------------------------------------------
+//- Scatter deserializer / Deserializer common tests
+//-----------------------------------------------------------------------------
+TEST(ScatterBitsDeserializer, OutOfRange)
+{
+    const auto chunks = split(BUFFER, { 3, 5 });
+    bits::ScatterBitsDeserializer deserializer(chunks);
+
+    ASSERT_THROW(deserializer.skip(256), std::out_of_range);
+    ASSERT_THROW(deserializer.extract<uint8_t>(129), std::out_of_range);
+}
+
+TEST(ScatterBitsDeserializer, ChainedExtract)
+{
+    const auto chunks = split(BUFFER, { 1, 1, 1 });
+    bits::ScatterBitsDeserializer deserializer(chunks);
+    uint8_t val1 = 0;
+    uint8_t val2 = 0;
+    uint8_t val3 = 0;
+    uint8_t val4 = 0;
+    uint8_t val5 = 0;
+
+    deserializer
+        .extract(val1, 4)
+        .extract(val2, 2)
+        .extract(val3, 8)
+        .extract(val4, 8)
+        .extract(val5, 8)
+    ;
+
+    ASSERT_EQ(val1, 0x03);
+    ASSERT_EQ(val2, 0x01);
+    ASSERT_EQ(val3, 0x7F);
+    ASSERT_EQ(val4, 0xDC);
+    ASSERT_EQ(val5, 0x0D);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 30);
+}
+
+TEST(ScatterBitsDeserializer, BitsManipulation_SkipAndReset)
+{
+    const auto chunks = split(BUFFER, { 2, 7, 0, 4 });
+    bits::ScatterBitsDeserializer deserializer(chunks);
+    uint16_t val1 = 0;
+    uint16_t val2 = 0;
+    uint16_t val3 = 0;
+
+    deserializer >> bits::skip(76) >> val1 >> bits::reset() >> bits::skip(12) >> val2 >> bits::reset() >> bits::skip(76) >> val3;
+
+    ASSERT_EQ(val1, 0xEBAB);
+    ASSERT_EQ(val2, 0xF703);
+    ASSERT_EQ(val3, 0xEBAB);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 92);
+}
+
+//-----------------------------------------------------------------------------
+//- ScatterBitsDeserializer specific tests
+//-----------------------------------------------------------------------------
+TEST(ScatterBitsDeserializer, Fields_CrossingChunks)
+{
+    const auto chunks = split(BUFFER, { 3, 1, 6 });
+    bits::ScatterBitsDeserializer deserializer(chunks, 4);
+
+    ASSERT_EQ(deserializer.extract<uint16_t>(16), 0x5FF7);
+    ASSERT_EQ(deserializer.extract<uint64_t>(), 0x035FF703'5FFCAFEBu);
+    ASSERT_EQ(deserializer.extract<int16_t>(12), -1'346);
+    ASSERT_EQ(deserializer.extract<uint32_t>(28), 0x0A5B6C7Du);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 120);
+}
+
+TEST(ScatterBitsDeserializer, PeekAndSeek)
+{
+    const auto chunks = split(BUFFER, { 3, 1, 6 });
+    bits::ScatterBitsDeserializer deserializer(chunks);
+
+    deserializer.seek(92);
+    ASSERT_EQ(deserializer.peek<uint16_t>(), 0xEA5B);
+    deserializer.seek(20);
+    ASSERT_EQ(deserializer.peek<uint16_t>(), 0x035F);
+    ASSERT_EQ(deserializer.extract<uint8_t>(), 0x03);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 28);
+}
+
+TEST(ScatterBitsDeserializer, Ranges)
+{
+    const auto chunks = split(BUFFER, { 2, 2 });
+    bits::ScatterBitsDeserializer deserializer(chunks, 4);
+    std::array<uint8_t, 3> array = {};
+    std::vector<uint8_t> vector(2, 0);
+    std::array<uint16_t, 4> inside = {};
+
+    deserializer >> array >> bits::nbits(4) >> vector >> bits::skip(4) >> inside;
+
+    ASSERT_THAT(array, ElementsAreArray(make_array<uint8_t>(0x5F, 0xF7, 0x03)));
+    ASSERT_THAT(vector, ElementsAreArray(make_array<uint8_t>(0x05, 0x0F)));
+    ASSERT_THAT(inside, ElementsAreArray(make_array<uint16_t>(0x7035, 0xFFCA, 0xFEBA, 0xBEA5)));
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 100);
+}
+
+TEST(ScatterBitsDeserializer, BitsOrder)
+{
+    const auto chunks = split(BUFFER, { 1, 2 });
+    bits::BasicScatterBitsDeserializer<bits::LsbFirstLittleEndian> deserializer(chunks);
+    uint8_t val1 = 0;
+    uint8_t val2 = 0;
+    uint16_t val3 = 0;
+    uint32_t val4 = 0;
+
+    deserializer.extract(val1, 4).extract(val2, 4);
+    deserializer >> val3 >> val4;
+
+    ASSERT_EQ(val1, 0x05);
+    ASSERT_EQ(val2, 0x03);
+    ASSERT_EQ(val3, 0x70FF);
+    ASSERT_EQ(val4, 0x3570FF35u);
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 56);
+}
+
+TEST(ScatterBitsDeserializer, Wide)
+{
+    const auto chunks = split(BUFFER, { 5, 6 });
+    bits::ScatterBitsDeserializer deserializer(chunks);
+    uint8_t val1 = 0;
+    bits::uint<96> val2;
+    bits::uint<24> val3;
+
+    deserializer >> val1 >> val2;
+    deserializer.extract(val3, 20);
+
+    ASSERT_EQ(val1, 0x35);
+    ASSERT_EQ(val2, bits::uint<96>(0xFF7035FF, 0x7035FFCAFEBABEA5));
+    ASSERT_EQ(val3, bits::uint<24>(0xB6C7D));
+    ASSERT_EQ(deserializer.nbBitsStreamed(), 124);
+}
+
+//-----------------------------------------------------------------------------
+//- Chains of fields of every width (whole bytes for swapped bytes orders),
+//- over chunks of various sizes, should give the same values as the
+//- deserializer over the linearized buffer
+//-----------------------------------------------------------------------------
+template<bits::detail::bits_order Order>
+void checkSameAsDeserializer(void)
+{
+    std::array<std::byte, 97> buffer = {};
+    for(size_t i=0; i<buffer.size(); i++)
+        buffer[i] = std::byte((i * 0x9D + 0x35) ^ (i >> 2));
+
+    const auto chunks = split(buffer, { 1, 7, 0, 2, 9, 3, 13, 1, 1, 5, 8, 11 });
+    const size_t step = Order::swap_bytes ? 8 : 1;
+    bits::BasicScatterBitsDeserializer<Order> scatter(chunks, 3);
+    bits::BasicBitsDeserializer<Order> deserializer(buffer, 3);
+
+    for(size_t nbBits=step; (scatter.nbBitsStreamed() + 3 + nbBits + step) <= (buffer.size() * CHAR_BIT); nbBits = (nbBits % 64) + step)
+    {
+        ASSERT_EQ(scatter.template extract<uint64_t>(nbBits), deserializer.template extract<uint64_t>(nbBits)) << "nbBits = " << nbBits;
+        ASSERT_EQ(scatter.template extract<int64_t>(step), deserializer.template extract<int64_t>(step));
+    }
+}
+
+TEST(ScatterBitsDeserializer, SameAsDeserializer)
+{
+    checkSameAsDeserializer<bits::MsbFirstBigEndian>();
+    checkSameAsDeserializer<bits::MsbFirstLittleEndian>();
+    checkSameAsDeserializer<bits::LsbFirstLittleEndian>();
+    checkSameAsDeserializer<bits::LsbFirstBigEndian>();
+}
@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_UINT_H
+#define BITS_UINT_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <climits>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <type_traits>
+
+#include <bits/detail/Traits.h>
+#include <bits/detail/wide_integer.h>
+
+namespace bits {
+
+//-----------------------------------------------------------------------------
+//- Fixed width unsigned integer of N bits, to insert / extract fields wider
+//- than 64 bits (IPv6 addresses, GUIDs, 96 bits timestamps...).
+//-
+//- The value is stored in the number of bytes needed to hold N bits, so that
+//- the default number of bits of insertion / extraction (size of the type) is
+//- N for whole bytes widths.
+//-----------------------------------------------------------------------------
+template<size_t N>
+class uint
+{
+    static_assert(N > 0);
+
+public:
+    static constexpr size_t nb_bits  = N;
+    static constexpr size_t nb_bytes = (N + CHAR_BIT - 1) / CHAR_BIT;
+    static constexpr size_t nb_words = (N + 63) / 64;
+
+    // Constructors
+    constexpr inline uint(void) noexcept = default;
+    constexpr inline uint(uint64_t val) noexcept;
+    template<std::integral... Words>
+    constexpr inline uint(uint64_t mostSignificantWord, Words... words) noexcept;
+
+    // Relationnal operators
+    constexpr bool operator ==(const uint & rhs) const noexcept = default;
+
+    // Accessors to 64 bits words (word 0 being the least significant one)
+    constexpr uint64_t word(size_t i) const noexcept;
+    constexpr void     set_word(size_t i, uint64_t val) noexcept;
+
+protected:
+    std::array<uint8_t, nb_bytes> bytes = {}; // Least significant byte first
+};
+
+namespace detail {
+
+template<size_t N> struct IsWideInteger<uint<N>> : std::true_type {};
+
+template<size_t N>
+struct WideInteger<uint<N>>
+{
+    static constexpr size_t nb_words  = uint<N>::nb_words;
+    static constexpr bool   is_signed = false;
+
+    static constexpr std::array<word_t, nb_words> to_words(const uint<N> & val) noexcept;
+    static constexpr uint<N> from_words(const std::array<word_t, nb_words> & words) noexcept;
+};
+
+} // namespace detail
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<size_t N>
+constexpr uint<N>::uint(uint64_t val) noexcept
+{
+    set_word(0, val);
+}
+
+//-----------------------------------------------------------------------------
+template<size_t N>
+template<std::integral... Words>
+constexpr uint<N>::uint(uint64_t mostSignificantWord, Words... words) noexcept
+{
+    static_assert(sizeof...(Words) < nb_words, "Too many words for the number of bits");
+
+    const uint64_t allWords[] = { mostSignificantWord, static_cast<uint64_t>(words)... };
+
+    for(size_t i=0; i<std::size(allWords); i++)
+        set_word(std::size(allWords) - i - 1, allWords[i]);
+}
+
+//-----------------------------------------------------------------------------
+template<size_t N>
+constexpr uint64_t uint<N>::word(size_t i) const noexcept
+{
+    uint64_t val = 0;
+
+    for(size_t b=i * 8; b<nb_bytes and b<(i + 1) * 8; b++)
+        val |= uint64_t(bytes[b]) << ((b % 8) * CHAR_BIT);
+
+    return val;
+}
+
+//-----------------------------------------------------------------------------
+template<size_t N>
+constexpr void uint<N>::set_word(size_t i, uint64_t val) noexcept
+{
+    if(i == (nb_words - 1) and (N % 64) != 0)
+        val &= (uint64_t(1) << (N % 64)) - 1;
+
+    for(size_t b=i * 8; b<nb_bytes and b<(i + 1) * 8; b++)
+        bytes[b] = static_cast<uint8_t>(val >> ((b % 8) * CHAR_BIT));
+}
+
+//-----------------------------------------------------------------------------
+//- Bytes being stored least significant first, the words are copied at once
+//- on little endian targets (the last word being masked to N bits)
+//-----------------------------------------------------------------------------
+template<size_t N>
+constexpr std::array<detail::word_t, detail::WideInteger<uint<N>>::nb_words> detail::WideInteger<uint<N>>::to_words(const uint<N> & val) noexcept
+{
+    std::array<word_t, nb_words> words = {};
+
+    if constexpr(std::endian::native == std::endian::little and sizeof(uint<N>) == uint<N>::nb_bytes)
+    {
+        if(not std::is_constant_evaluated())
+        {
+            std::memcpy(words.data(), static_cast<const void *>(&val), uint<N>::nb_bytes);
+            return words;
+        }
+    }
+
+    for(size_t i=0; i<nb_words; i++)
+        words[i] = val.word(i);
+
+    return words;
+}
+
+//-----------------------------------------------------------------------------
+template<size_t N>
+constexpr uint<N> detail::WideInteger<uint<N>>::from_words(const std::array<word_t, nb_words> & words) noexcept
+{
+    uint<N> val;
+
+    if constexpr(std::endian::native == std::endian::little and sizeof(uint<N>) == uint<N>::nb_bytes)
+    {
+        if(not std::is_constant_evaluated())
+        {
+            std::memcpy(static_cast<void *>(&val), words.data(), uint<N>::nb_bytes);
+            val.set_word(nb_words - 1, words[nb_words - 1]);
+            return val;
+        }
+    }
+
+    for(size_t i=0; i<nb_words; i++)
+        val.set_word(i, words[i]);
+
+    return val;
+}
+
+} // namespace bits
+
+#endif /* BITS_UINT_H */
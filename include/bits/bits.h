@@ -8,14 +8,27 @@
 #define BITS_BITS_H
 
 #include <bits/BitsTraits.h>
+#include <bits/BitsOrder.h>
+#include <bits/BoundsCheck.h>
 
 #include <bits/bits_insertion.h>
 #include <bits/bits_extraction.h>
 #include <bits/BitsSerializer.h>
 #include <bits/BitsDeserializer.h>
+#include <bits/BitsReader.h>
+#include <bits/BitsWriter.h>
+#include <bits/GrowableBitsSerializer.h>
+#include <bits/ScatterBitsDeserializer.h>
+#include <bits/RingBitsSerializer.h>
+#include <bits/RingBitsDeserializer.h>
+#include <bits/IncrementalBitsDeserializer.h>
+#include <bits/FusedFields.h>
+#include <bits/Layout.h>
+#include <bits/BitsFieldAggregate.h>
 
 #include <bits/Flags.h>
 #include <bits/Enum.h>
 #include <bits/BitsField.h>
+#include <bits/Uint.h>
 
 #endif /* BITS_BITS_H */
@@ -13,9 +13,19 @@
 #include <cassert>
 #include <iterator>
 #include <ranges>
+#include <span>
+#include <tuple>
+#include <utility>
 
 #include <bits/detail/Deserializer.h>
+#include <bits/detail/StaticDeserializer.h>
+#include <bits/detail/bulk_unpack.h>
+#include <bits/detail/byte_copy.h>
+#include <bits/detail/fields_groups.h>
+#include <bits/detail/pext_pdep.h>
+#include <bits/detail/wide_integer.h>
 #include <bits/detail/Traits.h>
+#include <bits/BitsOrder.h>
 
 namespace bits {
 
@@ -63,6 +73,92 @@ template<size_t high, size_t low, typename T, size_t nbBitsByElement = sizeof(st
 requires(detail::is_std_array_v<T>)
 constexpr T extract(const std::span<const std::byte> buffer);
 
+//-----------------------------------------------------------------------------
+//- Extract the bits selected by a compile time mask inside a compile time bits
+//- range (up to 64 bits), packed into the low bits of the value (PEXT)
+//-----------------------------------------------------------------------------
+template<uint64_t mask, size_t high, size_t low, detail::input_basic_type T>
+constexpr void extract_mask(const std::span<const std::byte> buffer, T & val);
+template<uint64_t mask, size_t high, size_t low, typename T>
+constexpr T extract_mask(const std::span<const std::byte> buffer);
+
+//-----------------------------------------------------------------------------
+//- Extract several fields with compile time bits ranges, such as BitsField
+//- types (any type with 'high' and 'low' bits and a 'value_type').
+//- Fields covered by a same word are grouped at compile time : the covering
+//- bytes are loaded once by group, and each field is a shift and a mask of
+//- the loaded word.
+//-     auto [version, ihl, length] = bits::extract_fields<BitsField<uint8_t, 3, 0>, BitsField<uint8_t, 7, 4>, BitsField<uint16_t, 31, 16>>(buffer);
+//-----------------------------------------------------------------------------
+template<detail::bits_range_spec... Fields>
+constexpr std::tuple<typename Fields::value_type...> extract_fields(const std::span<const std::byte> buffer);
+
+//-----------------------------------------------------------------------------
+//- View of a byte aligned bits range : the bytes of the buffer, without copy
+//- (whatever the bits order, as byte 'n' holds the bits '8n' to '8n + 7')
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low>
+constexpr std::span<const std::byte, (high - low + 1) / CHAR_BIT> view(const std::span<const std::byte> buffer);
+constexpr std::span<const std::byte> view(const std::span<const std::byte> buffer, size_t high, size_t low);
+
+//-----------------------------------------------------------------------------
+//- Same as above, with a bits order policy as first parameter
+//- (see BitsOrder.h)
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::input_basic_type T>
+constexpr void extract(Order order, const std::span<const std::byte> buffer, T & val, size_t high, size_t low);
+template<detail::bits_order Order, detail::output_iterator O, std::sentinel_for<O> S>
+constexpr void extract(Order order, const std::span<const std::byte> buffer, O first, S last, size_t high, size_t low, size_t nbBitsByElement = sizeof(std::iter_value_t<O>) * CHAR_BIT);
+template<detail::bits_order Order, detail::output_range R>
+constexpr void extract(Order order, const std::span<const std::byte> buffer, R && r, size_t high, size_t low, size_t nbBitsByElement = sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
+
+template<size_t high, size_t low, detail::bits_order Order, detail::input_basic_type T>
+constexpr void extract(Order order, const std::span<const std::byte> buffer, T & val);
+template<size_t high, size_t low, size_t nbBitsByElement, detail::bits_order Order, detail::output_iterator O, std::sentinel_for<O> S>
+constexpr void extract(Order order, const std::span<const std::byte> buffer, O first, S last);
+template<size_t high, size_t low, detail::bits_order Order, detail::output_iterator O, std::sentinel_for<O> S>
+constexpr void extract(Order order, const std::span<const std::byte> buffer, O first, S last);
+template<size_t high, size_t low, size_t nbBitsByElement, detail::bits_order Order, detail::output_range R>
+constexpr void extract(Order order, const std::span<const std::byte> buffer, R && r);
+template<size_t high, size_t low, detail::bits_order Order, detail::output_range R>
+constexpr void extract(Order order, const std::span<const std::byte> buffer, R && r);
+
+template<typename T, detail::bits_order Order>
+requires(not detail::is_std_array_v<T>)
+constexpr T extract(Order order, const std::span<const std::byte> buffer, size_t high, size_t low);
+template<typename T, detail::bits_order Order>
+requires(detail::is_std_array_v<T>)
+constexpr T extract(Order order, const std::span<const std::byte> buffer, size_t high, size_t low, size_t nbBitsByElement = sizeof(std::ranges::range_value_t<T>) * CHAR_BIT);
+
+template<size_t high, size_t low, typename T, detail::bits_order Order>
+requires(not detail::is_std_array_v<T>)
+constexpr T extract(Order order, const std::span<const std::byte> buffer);
+template<size_t high, size_t low, typename T, size_t nbBitsByElement = sizeof(std::ranges::range_value_t<T>) * CHAR_BIT, detail::bits_order Order>
+requires(detail::is_std_array_v<T>)
+constexpr T extract(Order order, const std::span<const std::byte> buffer);
+
+template<uint64_t mask, size_t high, size_t low, detail::bits_order Order, detail::input_basic_type T>
+constexpr void extract_mask(Order order, const std::span<const std::byte> buffer, T & val);
+template<uint64_t mask, size_t high, size_t low, typename T, detail::bits_order Order>
+constexpr T extract_mask(Order order, const std::span<const std::byte> buffer);
+
+template<detail::bits_range_spec... Fields, detail::bits_order Order>
+constexpr std::tuple<typename Fields::value_type...> extract_fields(Order order, const std::span<const std::byte> buffer);
+
+namespace detail {
+
+//-----------------------------------------------------------------------------
+//- Detail helper to extract fields grouped by covering word (the bits ranges
+//- being an array of 'grouped_field')
+//-----------------------------------------------------------------------------
+template<typename T>
+inline constexpr bool groupable_v = input_basic_type<T> and not IsWideInteger<T>::value and sizeof(T) <= WORD_BYTES;
+
+template<auto fields, bits_order Order, typename... T>
+constexpr void extract_grouped(Order order, const std::span<const std::byte> buffer, T & ... vals);
+
+} // namespace detail
+
 
 
 
@@ -80,10 +176,10 @@ constexpr T extract(const std::span<const std::byte> buffer);
 //-----------------------------------------------------------------------------
 namespace detail {
 
-template<size_t high, size_t low, size_t nbBitsByElement, detail::output_iterator O, std::size_t... I>
-constexpr void extract(const std::span<const std::byte> buffer, O first, std::index_sequence<I...>)
+template<size_t high, size_t low, size_t nbBitsByElement, detail::bits_order Order, detail::output_iterator O, std::size_t... I>
+constexpr void extract(Order order, const std::span<const std::byte> buffer, O first, std::index_sequence<I...>)
 {
-    ((bits::extract<(I + 1) * nbBitsByElement + low - 1, I * nbBitsByElement + low>(buffer, *std::next(first, I))), ...);
+    ((bits::extract<(I + 1) * nbBitsByElement + low - 1, I * nbBitsByElement + low>(order, buffer, *std::next(first, I))), ...);
 }
 
 } // namespace detail
@@ -95,24 +191,177 @@ constexpr void extract(const std::span<const std::byte> buffer, O first, std::in
 //-----------------------------------------------------------------------------
 template<detail::input_basic_type T>
 constexpr void extract(const std::span<const std::byte> buffer, T & val, size_t high, size_t low)
+{
+    extract(DefaultBitsOrder{}, buffer, val, high, low);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::output_iterator O, std::sentinel_for<O> S>
+constexpr void extract(const std::span<const std::byte> buffer, O first, S last, size_t high, size_t low, size_t nbBitsByElement)
+{
+    extract(DefaultBitsOrder{}, buffer, first, last, high, low, nbBitsByElement);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::output_range R>
+constexpr void extract(const std::span<const std::byte> buffer, R && r, size_t high, size_t low, size_t nbBitsByElement)
+{
+    extract(DefaultBitsOrder{}, buffer, std::ranges::begin(r), std::ranges::end(r), high, low, nbBitsByElement);
+}
+
+//-----------------------------------------------------------------------------
+//- Extract to output parameter with compile time bits range
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, detail::input_basic_type T>
+constexpr void extract(const std::span<const std::byte> buffer, T & val)
+{
+    extract<high, low>(DefaultBitsOrder{}, buffer, val);
+}
+
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, size_t nbBitsByElement, detail::output_iterator O, std::sentinel_for<O> S>
+constexpr void extract(const std::span<const std::byte> buffer, O first, S last)
+{
+    extract<high, low, nbBitsByElement>(DefaultBitsOrder{}, buffer, first, last);
+}
+
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, detail::output_iterator O, std::sentinel_for<O> S>
+constexpr void extract(const std::span<const std::byte> buffer, O first, S last)
+{
+    extract<high, low, sizeof(std::iter_value_t<O>) * CHAR_BIT>(DefaultBitsOrder{}, buffer, first, last);
+}
+
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, size_t nbBitsByElement, detail::output_range R>
+constexpr void extract(const std::span<const std::byte> buffer, R && r)
+{
+    extract<high, low, nbBitsByElement>(DefaultBitsOrder{}, buffer, std::ranges::begin(r), std::ranges::end(r));
+}
+
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, detail::output_range R>
+constexpr void extract(const std::span<const std::byte> buffer, R && r)
+{
+    extract<high, low>(DefaultBitsOrder{}, buffer, std::ranges::begin(r), std::ranges::end(r));
+}
+
+//-----------------------------------------------------------------------------
+//- Extract to return parameter with runtime bits range
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<typename T>
+requires(not detail::is_std_array_v<T>)
+constexpr T extract(const std::span<const std::byte> buffer, size_t high, size_t low)
+{
+    return extract<T>(DefaultBitsOrder{}, buffer, high, low);
+}
+
+//-----------------------------------------------------------------------------
+template<typename T>
+requires(detail::is_std_array_v<T>)
+constexpr T extract(const std::span<const std::byte> buffer, size_t high, size_t low, size_t nbBitsByElement)
+{
+    return extract<T>(DefaultBitsOrder{}, buffer, high, low, nbBitsByElement);
+}
+
+//-----------------------------------------------------------------------------
+//- Extract to output parameter with compile time bits range
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, typename T>
+requires(not detail::is_std_array_v<T>)
+constexpr T extract(const std::span<const std::byte> buffer)
+{
+    return extract<high, low, T>(DefaultBitsOrder{}, buffer);
+}
+
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, typename T, size_t nbBitsByElement>
+requires(detail::is_std_array_v<T>)
+constexpr T extract(const std::span<const std::byte> buffer)
+{
+    return extract<high, low, T, nbBitsByElement>(DefaultBitsOrder{}, buffer);
+}
+
+//-----------------------------------------------------------------------------
+//- Extract masked bits with compile time bits range
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<uint64_t mask, size_t high, size_t low, detail::input_basic_type T>
+constexpr void extract_mask(const std::span<const std::byte> buffer, T & val)
+{
+    extract_mask<mask, high, low>(DefaultBitsOrder{}, buffer, val);
+}
+
+//-----------------------------------------------------------------------------
+template<uint64_t mask, size_t high, size_t low, typename T>
+constexpr T extract_mask(const std::span<const std::byte> buffer)
+{
+    return extract_mask<mask, high, low, T>(DefaultBitsOrder{}, buffer);
+}
+
+//-----------------------------------------------------------------------------
+//- Extract to output parameter with runtime bits range and bits order policy
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::input_basic_type T>
+constexpr void extract(Order, const std::span<const std::byte> buffer, T & val, size_t high, size_t low)
 {
     assert((sizeof(T) * CHAR_BIT) >= (high - low + 1));
 
-    const detail::Deserializer deserializer(sizeof(T) * CHAR_BIT, high, low);
+    if constexpr(detail::IsWideInteger<T>::value)
+        detail::wide_extract<Order>(buffer, val, high, low);
+    else
+    {
+        const detail::Deserializer<Order> deserializer(sizeof(T) * CHAR_BIT, high, low);
 
-    deserializer.extract(buffer, val);
+        deserializer.extract(buffer, val);
+    }
 }
 
 //-----------------------------------------------------------------------------
-template<detail::output_iterator O, std::sentinel_for<O> S>
-constexpr void extract(const std::span<const std::byte> buffer, O first, S last, [[maybe_unused]] size_t high, size_t low, size_t nbBitsByElement)
+template<detail::bits_order Order, detail::output_iterator O, std::sentinel_for<O> S>
+constexpr void extract(Order order, const std::span<const std::byte> buffer, O first, S last, [[maybe_unused]] size_t high, size_t low, size_t nbBitsByElement)
 {
     assert((sizeof(std::iter_value_t<O>) * CHAR_BIT) >= nbBitsByElement);
     assert((std::distance(first, last) * sizeof(std::iter_value_t<O>) * CHAR_BIT) >= (high - low + 1));
 
+    // Byte aligned whole bytes elements : plain copy
+    if constexpr(detail::byte_copyable_range<O, S>)
+    {
+        if(detail::is_byte_copy<std::iter_value_t<O>>(low, nbBitsByElement))
+        {
+            const auto nbElements = static_cast<size_t>(last - first);
+            assert(high == (low + nbElements * nbBitsByElement - 1));
+
+            detail::byte_copy_extract<Order::byte_order>(buffer, std::to_address(first), nbElements, low);
+            return;
+        }
+    }
+
+    // Vectorized unpacking into contiguous integers array
+    if constexpr(detail::bulk_unpackable_range<Order, O, S>)
+    {
+        if(not std::is_constant_evaluated() and nbBitsByElement <= detail::BULK_UNPACK_MAX_BITS)
+        {
+            const auto nbElements = static_cast<size_t>(last - first);
+            assert(high == (low + nbElements * nbBitsByElement - 1));
+
+            detail::bulk_unpack(buffer, std::to_address(first), nbElements, low, nbBitsByElement);
+            return;
+        }
+    }
+
     while(first != last)
     {
-        extract(buffer, *first, low + nbBitsByElement - 1, low);
+        extract(order, buffer, *first, low + nbBitsByElement - 1, low);
         first++;
         low += nbBitsByElement;
     }
@@ -121,112 +370,246 @@ constexpr void extract(const std::span<const std::byte> buffer, O first, S last,
 }
 
 //-----------------------------------------------------------------------------
-template<detail::output_range R>
-constexpr void extract(const std::span<const std::byte> buffer, R && r, size_t high, size_t low, size_t nbBitsByElement)
+template<detail::bits_order Order, detail::output_range R>
+constexpr void extract(Order order, const std::span<const std::byte> buffer, R && r, size_t high, size_t low, size_t nbBitsByElement)
 {
-    extract(buffer, std::ranges::begin(r), std::ranges::end(r), high, low, nbBitsByElement);
+    extract(order, buffer, std::ranges::begin(r), std::ranges::end(r), high, low, nbBitsByElement);
 }
 
 //-----------------------------------------------------------------------------
-//- Extract to output parameter with compile time bits range
+//- Extract to output parameter with compile time bits range and bits order
+//- policy
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-template<size_t high, size_t low, detail::input_basic_type T>
-constexpr void extract(const std::span<const std::byte> buffer, T & val)
+template<size_t high, size_t low, detail::bits_order Order, detail::input_basic_type T>
+constexpr void extract(Order, const std::span<const std::byte> buffer, T & val)
 {
     assert((buffer.size() * CHAR_BIT) >= (high - low + 1));
     static_assert((sizeof(T) * CHAR_BIT) >= (high - low + 1));
 
-    constexpr detail::Deserializer deserializer(sizeof(T) * CHAR_BIT, high, low);
-
-    deserializer.extract(buffer, val);
+    if constexpr(detail::IsWideInteger<T>::value)
+        detail::wide_extract<high, low, Order>(buffer, val);
+    else
+        detail::StaticDeserializer<high, low, Order>::extract(buffer, val);
 }
 
 //-----------------------------------------------------------------------------
-template<size_t high, size_t low, size_t nbBitsByElement, detail::output_iterator O, std::sentinel_for<O> S>
-constexpr void extract(const std::span<const std::byte> buffer, O first, [[maybe_unused]] S last)
+template<size_t high, size_t low, size_t nbBitsByElement, detail::bits_order Order, detail::output_iterator O, std::sentinel_for<O> S>
+constexpr void extract(Order order, const std::span<const std::byte> buffer, O first, [[maybe_unused]] S last)
 {
     constexpr auto nElems = (high - low + 1) / nbBitsByElement;
     static_assert((sizeof(std::iter_value_t<O>) * CHAR_BIT) >= nbBitsByElement);
     assert(static_cast<size_t>(std::distance(first, last)) >= nElems);
 
-    detail::extract<high, low, nbBitsByElement>(buffer, first, std::make_index_sequence<nElems>());
+    if constexpr(detail::byte_copyable_range<O, O> and detail::is_byte_copy<std::iter_value_t<O>>(low, nbBitsByElement))
+        detail::byte_copy_extract<Order::byte_order>(buffer, std::to_address(first), nElems, low);
+    else
+        detail::extract<high, low, nbBitsByElement>(order, buffer, first, std::make_index_sequence<nElems>());
 }
 
 //-----------------------------------------------------------------------------
-template<size_t high, size_t low, detail::output_iterator O, std::sentinel_for<O> S>
-constexpr void extract(const std::span<const std::byte> buffer, O first, S last)
+template<size_t high, size_t low, detail::bits_order Order, detail::output_iterator O, std::sentinel_for<O> S>
+constexpr void extract(Order order, const std::span<const std::byte> buffer, O first, S last)
 {
-    extract<high, low, sizeof(std::iter_value_t<O>) * CHAR_BIT>(buffer, first, last);
+    extract<high, low, sizeof(std::iter_value_t<O>) * CHAR_BIT>(order, buffer, first, last);
 }
 
 //-----------------------------------------------------------------------------
-template<size_t high, size_t low, size_t nbBitsByElement, detail::output_range R>
-constexpr void extract(const std::span<const std::byte> buffer, R && r)
+template<size_t high, size_t low, size_t nbBitsByElement, detail::bits_order Order, detail::output_range R>
+constexpr void extract(Order order, const std::span<const std::byte> buffer, R && r)
 {
-    extract<high, low, nbBitsByElement>(buffer, std::ranges::begin(r), std::ranges::end(r));
+    extract<high, low, nbBitsByElement>(order, buffer, std::ranges::begin(r), std::ranges::end(r));
 }
 
 //-----------------------------------------------------------------------------
-template<size_t high, size_t low, detail::output_range R>
-constexpr void extract(const std::span<const std::byte> buffer, R && r)
+template<size_t high, size_t low, detail::bits_order Order, detail::output_range R>
+constexpr void extract(Order order, const std::span<const std::byte> buffer, R && r)
 {
-    extract<high, low>(buffer, std::ranges::begin(r), std::ranges::end(r));
+    extract<high, low>(order, buffer, std::ranges::begin(r), std::ranges::end(r));
 }
 
 //-----------------------------------------------------------------------------
-//- Extract to return parameter with runtime bits range
+//- Extract to return parameter with runtime bits range and bits order policy
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-template<typename T>
+template<typename T, detail::bits_order Order>
 requires(not detail::is_std_array_v<T>)
-constexpr T extract(const std::span<const std::byte> buffer, size_t high, size_t low)
+constexpr T extract(Order order, const std::span<const std::byte> buffer, size_t high, size_t low)
 {
     static_assert(not detail::is_std_span_v<T>, "extract() cannot return std::span type");
 
     T val;
-    extract(buffer, val, high, low);
+    extract(order, buffer, val, high, low);
     return val;
 }
 
 //-----------------------------------------------------------------------------
-template<typename T>
+template<typename T, detail::bits_order Order>
 requires(detail::is_std_array_v<T>)
-constexpr T extract(const std::span<const std::byte> buffer, size_t high, size_t low, size_t nbBitsByElement)
+constexpr T extract(Order order, const std::span<const std::byte> buffer, size_t high, size_t low, size_t nbBitsByElement)
 {
     T val;
-    extract(buffer, val, high, low, nbBitsByElement);
+    extract(order, buffer, val, high, low, nbBitsByElement);
     return val;
 }
 
 //-----------------------------------------------------------------------------
-//- Extract to output parameter with compile time bits range
+//- Extract to return parameter with compile time bits range and bits order
+//- policy
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-template<size_t high, size_t low, typename T>
+template<size_t high, size_t low, typename T, detail::bits_order Order>
 requires(not detail::is_std_array_v<T>)
-constexpr T extract(const std::span<const std::byte> buffer)
+constexpr T extract(Order order, const std::span<const std::byte> buffer)
 {
     static_assert(not detail::is_std_span_v<T>, "extract() cannot return std::span type");
 
     T val;
-    extract<high, low>(buffer, val);
+    extract<high, low>(order, buffer, val);
     return val;
 }
 
 //-----------------------------------------------------------------------------
-template<size_t high, size_t low, typename T, size_t nbBitsByElement>
+template<size_t high, size_t low, typename T, size_t nbBitsByElement, detail::bits_order Order>
 requires(detail::is_std_array_v<T>)
-constexpr T extract(const std::span<const std::byte> buffer)
+constexpr T extract(Order order, const std::span<const std::byte> buffer)
 {
     T val;
-    extract<high, low, nbBitsByElement>(buffer, val);
+    extract<high, low, nbBitsByElement>(order, buffer, val);
     return val;
 }
 
+//-----------------------------------------------------------------------------
+//- Extract masked bits with compile time bits range and bits order policy
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<uint64_t mask, size_t high, size_t low, detail::bits_order Order, detail::input_basic_type T>
+constexpr void extract_mask(Order, const std::span<const std::byte> buffer, T & val)
+{
+    constexpr auto nbBits = static_cast<size_t>(std::popcount(mask));
+    static_assert((high - low + 1) >= 64 or (mask >> (high - low + 1)) == 0, "Mask should be within the bits range");
+    static_assert((sizeof(T) * CHAR_BIT) >= nbBits);
+    assert((buffer.size() * CHAR_BIT) > high);
+
+    uint64_t window;
+    detail::StaticDeserializer<high, low, Order>::extract(buffer, window);
+
+    auto rawVal = detail::pext<mask>(window);
+    if constexpr(std::is_signed_v<T> and nbBits < detail::WORD_BITS)
+        rawVal = static_cast<detail::word_t>(static_cast<int64_t>(rawVal << (detail::WORD_BITS - nbBits)) >> (detail::WORD_BITS - nbBits));
+
+    val = static_cast<T>(static_cast<detail::underlying_integral_type_t<T>>(rawVal));
+}
+
+//-----------------------------------------------------------------------------
+template<uint64_t mask, size_t high, size_t low, typename T, detail::bits_order Order>
+constexpr T extract_mask(Order order, const std::span<const std::byte> buffer)
+{
+    T val;
+    extract_mask<mask, high, low>(order, buffer, val);
+    return val;
+}
+
+//-----------------------------------------------------------------------------
+//- Extract several fields grouped by covering word
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<detail::bits_range_spec... Fields>
+constexpr std::tuple<typename Fields::value_type...> extract_fields(const std::span<const std::byte> buffer)
+{
+    return extract_fields<Fields...>(DefaultBitsOrder{}, buffer);
+}
+
+//-----------------------------------------------------------------------------
+template<detail::bits_range_spec... Fields, detail::bits_order Order>
+constexpr std::tuple<typename Fields::value_type...> extract_fields(Order order, const std::span<const std::byte> buffer)
+{
+    constexpr std::array<detail::grouped_field, sizeof...(Fields)> fields = {
+        detail::grouped_field{ Fields::high, Fields::low, 0, detail::groupable_v<typename Fields::value_type> }...
+    };
+    std::tuple<typename Fields::value_type...> vals = {};
+
+    std::apply([&](auto & ... val)
+    {
+        detail::extract_grouped<fields>(order, buffer, val...);
+    }, vals);
+
+    return vals;
+}
+
+//-----------------------------------------------------------------------------
+//- One load by group, then a shift and a mask by field (with MSB first
+//- numbering, the last byte of the group is the least significant byte of
+//- the loaded word, and with LSB first numbering its first byte). Fields
+//- not grouped are extracted with their own kernel.
+//-----------------------------------------------------------------------------
+template<auto fields, detail::bits_order Order, typename... T>
+constexpr void detail::extract_grouped(Order order, const std::span<const std::byte> buffer, T & ... vals)
+{
+    constexpr auto & groups = fields_groups_v<fields>;
+    std::array<word_t, groups.nb_groups> words = {};
+
+    [&]<size_t... G>(std::index_sequence<G...>)
+    {
+        ((words[G] = load<fields_groups_v<fields>.nb_bytes[G], Order::natural_byte_order>(buffer, fields_groups_v<fields>.byte_start[G])), ...);
+    }(std::make_index_sequence<groups.nb_groups>{});
+
+    [&]<size_t... I>(std::index_sequence<I...>)
+    {
+        ([&]
+        {
+            constexpr grouped_field field = fields[I];
+            constexpr size_t group = fields_groups_v<fields>.group_of_field[I];
+            auto & val = std::get<I>(std::tie(vals...));
+
+            if constexpr(group == NO_GROUP and is_std_array_v<std::remove_cvref_t<decltype(val)>>)
+                bits::extract<field.high, field.low, field.nb_bits_by_element>(order, buffer, val);
+            else if constexpr(group == NO_GROUP)
+                bits::extract<field.high, field.low>(order, buffer, val);
+            else
+            {
+                constexpr size_t byteStart = fields_groups_v<fields>.byte_start[group];
+                constexpr size_t nbBytes   = fields_groups_v<fields>.nb_bytes[group];
+                constexpr size_t shift     = (Order::bit_order == BitOrder::LSB_FIRST)
+                    ? field.low - byteStart * CHAR_BIT
+                    : (byteStart + nbBytes) * CHAR_BIT - 1 - field.high;
+
+                StaticDeserializer<field.high, field.low, Order>::from_raw((words[group] >> shift) & mask_64bits(field.high - field.low + 1), val);
+            }
+        }(), ...);
+    }(std::index_sequence_for<T...>{});
+}
+
+//-----------------------------------------------------------------------------
+//- View of a byte aligned bits range
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low>
+constexpr std::span<const std::byte, (high - low + 1) / CHAR_BIT> view(const std::span<const std::byte> buffer)
+{
+    static_assert(high >= low);
+    static_assert((low % CHAR_BIT) == 0 and ((high + 1) % CHAR_BIT) == 0, "View bits range should be byte aligned");
+    assert((buffer.size() * CHAR_BIT) > high);
+
+    return buffer.template subspan<low / CHAR_BIT, (high - low + 1) / CHAR_BIT>();
+}
+
+//-----------------------------------------------------------------------------
+constexpr std::span<const std::byte> view(const std::span<const std::byte> buffer, size_t high, size_t low)
+{
+    assert(high >= low);
+    assert((low % CHAR_BIT) == 0 and ((high + 1) % CHAR_BIT) == 0);
+    assert((buffer.size() * CHAR_BIT) > high);
+
+    return buffer.subspan(low / CHAR_BIT, (high - low + 1) / CHAR_BIT);
+}
+
 } // namespace bits
 
 #endif /* BITS_BITS_EXTRACTION_H */
\ No newline at end of file
@@ -13,6 +13,10 @@
 #include <cstddef>
 
 #include <bits/bits_extraction.h>
+#include <bits/Uint.h>
+#include <bits/BitsField.h>
+#include <bits/detail/bulk_unpack.h>
+#include <bits/detail/pext_pdep.h>
 
 using ::testing::ElementsAreArray;
 
@@ -118,6 +122,27 @@ TEST(BitsExtraction_CppArray, Signed_32bits)
     ASSERT_EQ(bits::extract<int32_t>(buffer, 53, 28), -573553);
 }
 
+TEST(BitsExtraction_CppArray, Word_kernel)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    // Fields loaded in a single word
+    ASSERT_EQ(bits::extract<uint32_t>(buffer, 41,  10), 0xFDC0D7FD);
+    ASSERT_EQ(bits::extract<uint64_t>(buffer, 60,  4 ), 0x00BF'EE06'BFEE'06BF);
+    ASSERT_EQ(bits::extract<uint64_t>(buffer, 63,  7 ), 0x01FF'7035'FF70'35FF);
+    ASSERT_EQ(bits::extract<int64_t> (buffer, 63,  7 ), -158097755589121);
+
+    // Fields crossing a 9th byte
+    ASSERT_EQ(bits::extract<uint64_t>(buffer, 64,  8 ), 0x01FE'E06B'FEE0'6BFF);
+    ASSERT_EQ(bits::extract<uint64_t>(buffer, 66,  3 ), 0xAFFB'81AF'FB81'AFFE);
+    ASSERT_EQ(bits::extract<int64_t> (buffer, 66,  3 ), -5765872305078947842);
+
+    // Fields too close to the buffer end (byte-by-byte fallback)
+    ASSERT_EQ(bits::extract<uint64_t>(buffer, 125, 70), 0x00BF'AEAF'A96D'B1F6);
+    ASSERT_EQ(bits::extract<int64_t> (buffer, 125, 70), -18103804001144330);
+    ASSERT_EQ(bits::extract<uint32_t>(buffer, 127, 96), 0xA5B6C7D8);
+}
+
 TEST(BitsExtraction_CppArray, Ranges)
 {
     const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF);
@@ -325,6 +350,34 @@ TEST(BitsExtraction_CppArray, TemplatedPosition_Signed_32bits)
     ASSERT_EQ((bits::extract<53, 28, int32_t>(buffer)), -573553);
 }
 
+TEST(BitsExtraction_CppArray, TemplatedPosition_Word_kernel)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    ASSERT_EQ((bits::extract<41,  10, uint32_t>(buffer)), 0xFDC0D7FD);
+    ASSERT_EQ((bits::extract<60,  4,  uint64_t>(buffer)), 0x00BF'EE06'BFEE'06BF);
+    ASSERT_EQ((bits::extract<63,  7,  uint64_t>(buffer)), 0x01FF'7035'FF70'35FF);
+    ASSERT_EQ((bits::extract<63,  7,  int64_t> (buffer)), -158097755589121);
+    ASSERT_EQ((bits::extract<64,  8,  uint64_t>(buffer)), 0x01FE'E06B'FEE0'6BFF);
+    ASSERT_EQ((bits::extract<66,  3,  uint64_t>(buffer)), 0xAFFB'81AF'FB81'AFFE);
+    ASSERT_EQ((bits::extract<66,  3,  int64_t> (buffer)), -5765872305078947842);
+    ASSERT_EQ((bits::extract<125, 70, uint64_t>(buffer)), 0x00BF'AEAF'A96D'B1F6);
+    ASSERT_EQ((bits::extract<125, 70, int64_t> (buffer)), -18103804001144330);
+    ASSERT_EQ((bits::extract<127, 96, uint32_t>(buffer)), 0xA5B6C7D8);
+    ASSERT_EQ((bits::extract<127, 72, uint64_t>(buffer)), 0x00FE'BABE'A5B6'C7D8);
+}
+
+TEST(BitsExtraction_CppArray, TemplatedPosition_Constexpr)
+{
+    static constexpr auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    static_assert(bits::extract<5,   4,  uint8_t> (buffer) == 0x01);
+    static_assert(bits::extract<13,  6,  uint8_t> (buffer) == 0x7F);
+    static_assert(bits::extract<41,  10, uint32_t>(buffer) == 0xFDC0D7FD);
+    static_assert(bits::extract<66,  3,  uint64_t>(buffer) == 0xAFFB'81AF'FB81'AFFE);
+    static_assert(bits::extract<127, 96, uint32_t>(buffer) == 0xA5B6C7D8);
+}
+
 TEST(BitsExtraction_CppArray, TemplatedPosition_Ranges)
 {
     const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF);
@@ -429,3 +482,472 @@ TEST(BitsExtraction_CppArray, TemplatedPosition_Ranges_Small_Values)
     // std_span = bits::extract<15, 4, std::span<uint8_t, 3>, 4>(buffer);
     // ASSERT_THAT(std_span, ElementsAreArray(make_array<uint8_t>(0x05, 0x0F, 0x0F)));
 }
+
+TEST(BitsExtraction_BitsOrder, LsbFirst_LittleEndian)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    ASSERT_EQ(bits::extract<uint8_t >(bits::lsb_first_little_endian, buffer, 3,   0  ), 0x05);
+    ASSERT_EQ(bits::extract<uint8_t >(bits::lsb_first_little_endian, buffer, 13,  6  ), 0xFC);
+    ASSERT_EQ(bits::extract<int8_t  >(bits::lsb_first_little_endian, buffer, 13,  6  ), -4);
+    ASSERT_EQ(bits::extract<uint32_t>(bits::lsb_first_little_endian, buffer, 23,  4  ), 0x00070FF3u);
+    ASSERT_EQ(bits::extract<uint64_t>(bits::lsb_first_little_endian, buffer, 63,  0  ), 0xFF3570FF3570FF35ull);
+    ASSERT_EQ(bits::extract<uint64_t>(bits::lsb_first_little_endian, buffer, 67,  4  ), 0xAFF3570FF3570FF3ull);
+    ASSERT_EQ(bits::extract<int8_t  >(bits::lsb_first_little_endian, buffer, 76,  70 ), -5);
+    ASSERT_EQ(bits::extract<uint32_t>(bits::lsb_first_little_endian, buffer, 127, 100), 0x0D8C7B6Au);
+    ASSERT_EQ(bits::extract<int32_t >(bits::lsb_first_little_endian, buffer, 127, 100), -41125014);
+}
+
+TEST(BitsExtraction_BitsOrder, LsbFirst_BigEndian)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    ASSERT_EQ(bits::extract<uint16_t>(bits::lsb_first_big_endian, buffer, 23,  8 ), 0xFF70);
+    ASSERT_EQ(bits::extract<int16_t >(bits::lsb_first_big_endian, buffer, 23,  8 ), -144);
+    ASSERT_EQ(bits::extract<uint32_t>(bits::lsb_first_big_endian, buffer, 35,  4 ), 0xF30F57F3u);
+    ASSERT_EQ(bits::extract<uint32_t>(bits::lsb_first_big_endian, buffer, 127, 96), 0xA5B6C7D8u);
+}
+
+TEST(BitsExtraction_BitsOrder, MsbFirst_LittleEndian)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    ASSERT_EQ(bits::extract<uint16_t>(bits::msb_first_little_endian, buffer, 15,  0  ), 0xFF35);
+    ASSERT_EQ(bits::extract<int16_t >(bits::msb_first_little_endian, buffer, 15,  0  ), -203);
+    ASSERT_EQ(bits::extract<uint32_t>(bits::msb_first_little_endian, buffer, 35,  4  ), 0x5F03F75Fu);
+    ASSERT_EQ(bits::extract<uint64_t>(bits::msb_first_little_endian, buffer, 75,  12 ), 0xAFFC5F03F75F03F7ull);
+    ASSERT_EQ(bits::extract<uint32_t>(bits::msb_first_little_endian, buffer, 127, 104), 0x00D8C7B6u);
+    ASSERT_EQ(bits::extract<uint16_t>(bits::msb_first_big_endian,    buffer, 15,  0  ), 0x35FF);
+}
+
+TEST(BitsExtraction_BitsOrder, TemplatedPosition)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    ASSERT_EQ((bits::extract<3,   0,   uint8_t >(bits::lsb_first_little_endian, buffer)), 0x05);
+    ASSERT_EQ((bits::extract<13,  6,   int8_t  >(bits::lsb_first_little_endian, buffer)), -4);
+    ASSERT_EQ((bits::extract<23,  4,   uint32_t>(bits::lsb_first_little_endian, buffer)), 0x00070FF3u);
+    ASSERT_EQ((bits::extract<63,  0,   uint64_t>(bits::lsb_first_little_endian, buffer)), 0xFF3570FF3570FF35ull);
+    ASSERT_EQ((bits::extract<67,  4,   uint64_t>(bits::lsb_first_little_endian, buffer)), 0xAFF3570FF3570FF3ull);
+    ASSERT_EQ((bits::extract<127, 100, int32_t >(bits::lsb_first_little_endian, buffer)), -41125014);
+    ASSERT_EQ((bits::extract<23,  8,   int16_t >(bits::lsb_first_big_endian,    buffer)), -144);
+    ASSERT_EQ((bits::extract<35,  4,   uint32_t>(bits::lsb_first_big_endian,    buffer)), 0xF30F57F3u);
+    ASSERT_EQ((bits::extract<15,  0,   int16_t >(bits::msb_first_little_endian, buffer)), -203);
+    ASSERT_EQ((bits::extract<35,  4,   uint32_t>(bits::msb_first_little_endian, buffer)), 0x5F03F75Fu);
+    ASSERT_EQ((bits::extract<75,  12,  uint64_t>(bits::msb_first_little_endian, buffer)), 0xAFFC5F03F75F03F7ull);
+
+    static constexpr auto constBuffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE);
+    static_assert(bits::extract<67, 4,  uint64_t>(bits::lsb_first_little_endian, constBuffer) == 0xAFF3570FF3570FF3ull);
+    static_assert(bits::extract<75, 12, uint64_t>(bits::msb_first_little_endian, constBuffer) == 0xAFFC5F03F75F03F7ull);
+}
+
+TEST(BitsExtraction_BitsOrder, Ranges)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF);
+    std::array<uint16_t, 4> values;
+
+    bits::extract(bits::msb_first_little_endian, buffer, values, 63, 0);
+    ASSERT_THAT(values, ElementsAreArray({ 0xFF35, 0x3570, 0x70FF, 0xFF35 }));
+
+    bits::extract<63, 0>(bits::lsb_first_little_endian, buffer, values);
+    ASSERT_THAT(values, ElementsAreArray({ 0xFF35, 0x3570, 0x70FF, 0xFF35 }));
+
+    std::array<uint8_t, 4> nibbles;
+    bits::extract(bits::lsb_first_little_endian, buffer, nibbles, 15, 0, 4);
+    ASSERT_THAT(nibbles, ElementsAreArray({ 0x5, 0x3, 0xF, 0xF }));
+}
+
+//-----------------------------------------------------------------------------
+//- Bulk unpacking kernels should be bit for bit identical to the element by
+//- element extraction
+//-----------------------------------------------------------------------------
+template<typename T>
+void checkBulkUnpack(void)
+{
+    std::vector<std::byte> buffer(600);
+    uint32_t seed = 0x12345678;
+    for(auto & byte : buffer)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        byte = std::byte(seed >> 24);
+    }
+
+    for(size_t nbBits = 1; nbBits <= std::min<size_t>(sizeof(T) * CHAR_BIT, 32); nbBits++)
+    {
+        for(size_t low : { 0, 1, 5, 7, 12, 19 })
+        {
+            // Fields up to the buffer's last bit, to check kernels tails
+            const size_t nbElements = (buffer.size() * CHAR_BIT - low) / nbBits;
+            const size_t high = low + nbElements * nbBits - 1;
+            const auto span = std::span<const std::byte>(buffer).subspan(0, (high / CHAR_BIT) + 1);
+
+            std::vector<T> expected(nbElements);
+            for(size_t i = 0; i < nbElements; i++)
+                expected[i] = bits::extract<T>(span, low + (i + 1) * nbBits - 1, low + i * nbBits);
+
+            std::vector<T> values(nbElements);
+            bits::extract(span, values, high, low, nbBits);
+            ASSERT_EQ(values, expected) << "nbBits=" << nbBits << " low=" << low;
+
+            std::fill(values.begin(), values.end(), T());
+            bits::detail::bulk_unpack_scalar(span, values.data(), nbElements, low, nbBits);
+            ASSERT_EQ(values, expected) << "scalar nbBits=" << nbBits << " low=" << low;
+
+#if BITS_X86_SIMD
+            if(bits::detail::cpu_features().sse42)
+            {
+                std::fill(values.begin(), values.end(), T());
+                bits::detail::bulk_unpack_sse42(span, values.data(), nbElements, low, nbBits);
+                ASSERT_EQ(values, expected) << "sse4.2 nbBits=" << nbBits << " low=" << low;
+            }
+            if(bits::detail::cpu_features().avx2)
+            {
+                std::fill(values.begin(), values.end(), T());
+                bits::detail::bulk_unpack_avx2(span, values.data(), nbElements, low, nbBits);
+                ASSERT_EQ(values, expected) << "avx2 nbBits=" << nbBits << " low=" << low;
+            }
+#endif
+        }
+    }
+}
+
+TEST(BitsExtraction_Bulk, Unsigned)
+{
+    checkBulkUnpack<uint8_t>();
+    checkBulkUnpack<uint16_t>();
+    checkBulkUnpack<uint32_t>();
+    checkBulkUnpack<uint64_t>();
+}
+
+TEST(BitsExtraction_Bulk, Signed)
+{
+    checkBulkUnpack<int8_t>();
+    checkBulkUnpack<int16_t>();
+    checkBulkUnpack<int32_t>();
+    checkBulkUnpack<int64_t>();
+}
+
+TEST(BitsExtraction_Mask, Unsigned)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    ASSERT_EQ((bits::extract_mask<0xF00F,             15,  0,  uint8_t >(buffer)), 0x3F);
+    ASSERT_EQ((bits::extract_mask<0x0FF0,             15,  0,  uint8_t >(buffer)), 0x5F);
+    ASSERT_EQ((bits::extract_mask<0x8001,             15,  0,  uint8_t >(buffer)), 0x01);
+    ASSERT_EQ((bits::extract_mask<0xAA,               13,  6,  uint8_t >(buffer)), 0x07);
+    ASSERT_EQ((bits::extract_mask<0xFF0000FF,         41,  10, uint16_t>(buffer)), 0xFDFD);
+    ASSERT_EQ((bits::extract_mask<0xF0F0F0F0F0F0F0F0, 66,  3,  uint32_t>(buffer)), 0xAF8AF8AFu);
+    ASSERT_EQ((bits::extract_mask<0x8000000000000001, 66,  3,  uint8_t >(buffer)), 0x02);
+    ASSERT_EQ((bits::extract_mask<0x00FF00FF,         127, 96, uint16_t>(buffer)), 0xB6D8);
+
+    uint16_t val;
+    bits::extract_mask<0xFF00FF00, 127, 96>(buffer, val);
+    ASSERT_EQ(val, 0xA5C7);
+}
+
+TEST(BitsExtraction_Mask, Signed)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    ASSERT_EQ((bits::extract_mask<0xF00F,     15, 0,  int8_t >(buffer)), 63);
+    ASSERT_EQ((bits::extract_mask<0x00F0,     15, 0,  int8_t >(buffer)), -1);
+    ASSERT_EQ((bits::extract_mask<0xFF0000FF, 41, 10, int16_t>(buffer)), -515);
+    ASSERT_EQ((bits::extract_mask<0xFF0000FF, 41, 10, int32_t>(buffer)), -515);
+}
+
+TEST(BitsExtraction_Mask, Constexpr)
+{
+    static constexpr auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    static_assert(bits::extract_mask<0xF00F,             15, 0,  uint8_t >(buffer) == 0x3F);
+    static_assert(bits::extract_mask<0xFF0000FF,         41, 10, int16_t >(buffer) == -515);
+    static_assert(bits::extract_mask<0xF0F0F0F0F0F0F0F0, 66, 3,  uint32_t>(buffer) == 0xAF8AF8AFu);
+}
+
+TEST(BitsExtraction_Mask, BitsOrder)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    ASSERT_EQ((bits::extract_mask<0x0FF0, 15, 0, uint8_t>(bits::lsb_first_little_endian, buffer)), 0xF3);
+    ASSERT_EQ((bits::extract_mask<0x0FF0, 15, 0, uint8_t>(bits::msb_first_little_endian, buffer)), 0xF3);
+    ASSERT_EQ((bits::extract_mask<0x0FF0, 15, 0, uint8_t>(bits::msb_first_big_endian,    buffer)), 0x5F);
+}
+
+template<uint64_t mask>
+void checkMaskKernels(void)
+{
+    for(uint64_t val : { 0x0000000000000000ull, 0xFFFFFFFFFFFFFFFFull, 0xAFFB81AFFB81AFFEull, 0x0123456789ABCDEFull })
+    {
+        uint64_t expectedPext = 0;
+        uint64_t expectedPdep = 0;
+        for(size_t i = 0, k = 0; i < 64; i++)
+        {
+            if((mask >> i) & 1)
+            {
+                expectedPext |= ((val >> i) & 1) << k;
+                expectedPdep |= ((val >> k) & 1) << i;
+                k++;
+            }
+        }
+
+        ASSERT_EQ(bits::detail::pext<mask>(val), expectedPext) << std::hex << "mask=" << mask << " val=" << val;
+        ASSERT_EQ(bits::detail::pdep<mask>(val), expectedPdep) << std::hex << "mask=" << mask << " val=" << val;
+        ASSERT_EQ(bits::detail::pext_portable<mask>(val), expectedPext) << std::hex << "mask=" << mask << " val=" << val;
+        ASSERT_EQ(bits::detail::pdep_portable<mask>(val), expectedPdep) << std::hex << "mask=" << mask << " val=" << val;
+#if BITS_X86_SIMD
+        if(bits::detail::cpu_features().bmi2)
+        {
+            ASSERT_EQ(bits::detail::pext_bmi2(val, mask), expectedPext) << std::hex << "mask=" << mask << " val=" << val;
+            ASSERT_EQ(bits::detail::pdep_bmi2(val, mask), expectedPdep) << std::hex << "mask=" << mask << " val=" << val;
+        }
+#endif
+    }
+}
+
+TEST(BitsExtraction_Mask, Kernels)
+{
+    checkMaskKernels<0x0000000000000001>();
+    checkMaskKernels<0x8000000000000000>();
+    checkMaskKernels<0x00000000000FF000>();
+    checkMaskKernels<0xFFFFFFFFFFFFFFFF>();
+    checkMaskKernels<0x8000000000000001>();
+    checkMaskKernels<0xF0F0F0F0F0F0F0F0>();
+    checkMaskKernels<0x5555555555555555>();
+    checkMaskKernels<0x00FF00000000FF01>();
+}
+
+TEST(BitsExtraction_ByteAligned, Ranges_Bytes)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+    const auto expected = make_array(0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35);
+
+    std::array<std::byte, 6> mac;
+    bits::extract(buffer, mac, 55, 8);
+    ASSERT_THAT(mac, ElementsAreArray(expected));
+
+    std::vector<uint8_t> vec(6);
+    bits::extract(bits::lsb_first_little_endian, buffer, vec, 55, 8);
+    ASSERT_THAT(vec, ElementsAreArray(make_array<uint8_t>(0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35)));
+
+    ASSERT_THAT((bits::extract<55, 8, std::array<std::byte, 6>, 8>(buffer)), ElementsAreArray(expected));
+    ASSERT_THAT((bits::extract<127, 0, std::array<std::byte, 16>, 8>(buffer)), ElementsAreArray(buffer));
+}
+
+TEST(BitsExtraction_ByteAligned, Ranges_Words)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    std::array<uint16_t, 4> words;
+    bits::extract(buffer, words, 79, 16);
+    ASSERT_THAT(words, ElementsAreArray(make_array<uint16_t>(0x7035, 0xFF70, 0x35FF, 0xCAFE)));
+    bits::extract(bits::msb_first_little_endian, buffer, words, 79, 16);
+    ASSERT_THAT(words, ElementsAreArray(make_array<uint16_t>(0x3570, 0x70FF, 0xFF35, 0xFECA)));
+    bits::extract(bits::lsb_first_little_endian, buffer, words, 79, 16);
+    ASSERT_THAT(words, ElementsAreArray(make_array<uint16_t>(0x3570, 0x70FF, 0xFF35, 0xFECA)));
+    bits::extract(bits::lsb_first_big_endian, buffer, words, 79, 16);
+    ASSERT_THAT(words, ElementsAreArray(make_array<uint16_t>(0x7035, 0xFF70, 0x35FF, 0xCAFE)));
+
+    std::array<int32_t, 2> dwords;
+    bits::extract<127, 64>(buffer, dwords);
+    ASSERT_THAT(dwords, ElementsAreArray(make_array<int32_t>(int32_t(0xCAFEBABE), int32_t(0xA5B6C7D8))));
+    bits::extract<127, 64>(bits::lsb_first_little_endian, buffer, dwords);
+    ASSERT_THAT(dwords, ElementsAreArray(make_array<int32_t>(int32_t(0xBEBAFECA), int32_t(0xD8C7B6A5))));
+}
+
+TEST(BitsExtraction_ByteAligned, Constexpr)
+{
+    static constexpr auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    static_assert(bits::extract<79, 64, std::array<std::byte, 2>, 8>(buffer)[1] == std::byte(0xFE));
+    static_assert(bits::extract<127, 96, std::array<uint16_t, 2>, 16>(buffer)[1] == 0xC7D8);
+    static_assert(bits::extract<uint64_t>(buffer, 127, 64) == 0xCAFEBABEA5B6C7D8);
+}
+
+TEST(BitsExtraction_ByteAligned, Buffer_tail)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    ASSERT_EQ(bits::extract<uint64_t>(buffer, 127, 72), 0xFEBABEA5B6C7D8u);
+    ASSERT_EQ(bits::extract<uint32_t>(buffer, 127, 104), 0xB6C7D8u);
+    ASSERT_EQ(bits::extract<int32_t >(buffer, 127, 104), -4798504);
+    ASSERT_EQ(bits::extract<uint32_t>(bits::msb_first_little_endian, buffer, 127, 104), 0xD8C7B6u);
+}
+
+#if BITS_HAS_INT128
+constexpr bits::detail::uint128_t make_uint128(uint64_t high, uint64_t low) noexcept
+{
+    return (bits::detail::uint128_t(high) << 64) | low;
+}
+
+TEST(BitsExtraction_Wide, Int128)
+{
+    using bits::detail::uint128_t;
+    using bits::detail::int128_t;
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    ASSERT_TRUE(bits::extract<uint128_t>(buffer, 127, 0) == make_uint128(0x35FF7035FF7035FF, 0xCAFEBABEA5B6C7D8));
+    ASSERT_TRUE(bits::extract<uint128_t>(buffer, 126, 3) == make_uint128(0x0AFFB81AFFB81AFF, 0xE57F5D5F52DB63EC));
+    ASSERT_TRUE(bits::extract<uint128_t>(buffer, 75,  4) == make_uint128(0x5F, 0xF7035FF7035FFCAF));
+    ASSERT_TRUE(bits::extract<uint128_t>(buffer, 23,  8) == 0xFF70);
+    ASSERT_TRUE(bits::extract<int128_t >(buffer, 127, 8) == int128_t(make_uint128(0xFFFF7035FF7035FF, 0xCAFEBABEA5B6C7D8)));
+    ASSERT_TRUE(bits::extract<int128_t >(buffer, 23,  8) == -144);
+
+    ASSERT_TRUE((bits::extract<127, 0, uint128_t>(buffer)) == make_uint128(0x35FF7035FF7035FF, 0xCAFEBABEA5B6C7D8));
+    ASSERT_TRUE((bits::extract<126, 3, uint128_t>(buffer)) == make_uint128(0x0AFFB81AFFB81AFF, 0xE57F5D5F52DB63EC));
+    ASSERT_TRUE((bits::extract<127, 8, int128_t >(buffer)) == int128_t(make_uint128(0xFFFF7035FF7035FF, 0xCAFEBABEA5B6C7D8)));
+}
+
+TEST(BitsExtraction_Wide, Int128_BitsOrder)
+{
+    using bits::detail::uint128_t;
+    using bits::detail::int128_t;
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    ASSERT_TRUE(bits::extract<uint128_t>(bits::lsb_first_little_endian, buffer, 127, 0) == make_uint128(0xD8C7B6A5BEBAFECA, 0xFF3570FF3570FF35));
+    ASSERT_TRUE(bits::extract<uint128_t>(bits::lsb_first_little_endian, buffer, 126, 3) == make_uint128(0x0B18F6D4B7D75FD9, 0x5FE6AE1FE6AE1FE6));
+    ASSERT_TRUE(bits::extract<int128_t >(bits::lsb_first_little_endian, buffer, 127, 8) == int128_t(make_uint128(0xFFD8C7B6A5BEBAFE, 0xCAFF3570FF3570FF)));
+    ASSERT_TRUE(bits::extract<uint128_t>(bits::msb_first_little_endian, buffer, 127, 0) == make_uint128(0xD8C7B6A5BEBAFECA, 0xFF3570FF3570FF35));
+    ASSERT_TRUE(bits::extract<int128_t >(bits::msb_first_little_endian, buffer, 127, 8) == int128_t(make_uint128(0xFFD8C7B6A5BEBAFE, 0xCAFF3570FF3570FF)));
+    ASSERT_TRUE(bits::extract<uint128_t>(bits::lsb_first_big_endian,    buffer, 127, 0) == make_uint128(0x35FF7035FF7035FF, 0xCAFEBABEA5B6C7D8));
+
+    ASSERT_TRUE((bits::extract<126, 3, uint128_t>(bits::lsb_first_little_endian, buffer)) == make_uint128(0x0B18F6D4B7D75FD9, 0x5FE6AE1FE6AE1FE6));
+    ASSERT_TRUE((bits::extract<127, 8, int128_t >(bits::msb_first_little_endian, buffer)) == int128_t(make_uint128(0xFFD8C7B6A5BEBAFE, 0xCAFF3570FF3570FF)));
+}
+
+TEST(BitsExtraction_Wide, Int128_Constexpr)
+{
+    using bits::detail::uint128_t;
+    static constexpr auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    static_assert(bits::extract<126, 3, uint128_t>(buffer) == make_uint128(0x0AFFB81AFFB81AFF, 0xE57F5D5F52DB63EC));
+    static_assert(bits::extract<uint128_t>(bits::lsb_first_little_endian, buffer, 126, 3) == make_uint128(0x0B18F6D4B7D75FD9, 0x5FE6AE1FE6AE1FE6));
+}
+#endif
+
+TEST(BitsExtraction_Wide, Uint)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    ASSERT_EQ(bits::extract<bits::uint<96> >(buffer, 95,  0 ), bits::uint<96>(0x35FF7035, 0xFF7035FFCAFEBABE));
+    ASSERT_EQ(bits::extract<bits::uint<96> >(buffer, 127, 32), bits::uint<96>(0xFF7035FF, 0xCAFEBABEA5B6C7D8));
+    ASSERT_EQ(bits::extract<bits::uint<128>>(buffer, 127, 0 ), bits::uint<128>(0x35FF7035FF7035FF, 0xCAFEBABEA5B6C7D8));
+    ASSERT_EQ(bits::extract<bits::uint<72> >(buffer, 75,  4 ), bits::uint<72>(0x5F, 0xF7035FF7035FFCAF));
+    ASSERT_EQ(bits::extract<bits::uint<72> >(buffer, 23,  8 ), bits::uint<72>(0xFF70));
+
+    ASSERT_EQ((bits::extract<127, 32, bits::uint<96>>(buffer)), bits::uint<96>(0xFF7035FF, 0xCAFEBABEA5B6C7D8));
+    ASSERT_EQ((bits::extract<75,  4,  bits::uint<72>>(buffer)), bits::uint<72>(0x5F, 0xF7035FF7035FFCAF));
+
+    ASSERT_EQ(bits::extract<bits::uint<96>>(bits::msb_first_little_endian, buffer, 127, 32), bits::uint<96>(0xD8C7B6A5, 0xBEBAFECAFF3570FF));
+    ASSERT_EQ((bits::extract<127, 32, bits::uint<96>>(bits::lsb_first_big_endian, buffer)), bits::uint<96>(0xFF7035FF, 0xCAFEBABEA5B6C7D8));
+
+    static constexpr auto constBuffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+    static_assert(bits::extract<127, 32, bits::uint<96>>(constBuffer) == bits::uint<96>(0xFF7035FF, 0xCAFEBABEA5B6C7D8));
+}
+
+TEST(BitsExtraction_View, View)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    const auto bytes = bits::view<95, 64>(buffer);
+    static_assert(decltype(bytes)::extent == 4);
+    ASSERT_EQ(bytes.data(), buffer.data() + 8);
+    ASSERT_THAT(bytes, ElementsAreArray(make_array(0xCA, 0xFE, 0xBA, 0xBE)));
+
+    ASSERT_EQ(bits::view(buffer, 127, 120).data(), buffer.data() + 15);
+    ASSERT_EQ(bits::view(buffer, 127, 120).size(), 1u);
+    ASSERT_EQ(bits::view(buffer, 127, 0).size(), buffer.size());
+
+    static constexpr auto constBuffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF);
+    static_assert(bits::view<31, 16>(constBuffer)[1] == std::byte(0x35));
+}
+
+TEST(BitsExtraction_Fields, Groups)
+{
+    constexpr std::array<bits::detail::grouped_field, 6> fields = {{
+        { 3, 0, 0, true }, { 7, 4, 0, true }, { 31, 16, 0, true }, { 63, 51, 0, true }, { 71, 64, 0, true }, { 200, 72, 0, false }
+    }};
+    constexpr auto groups = bits::detail::group_fields(fields);
+
+    static_assert(groups.nb_groups == 2);
+    static_assert(groups.group_of_field[3] == 0 and groups.byte_start[0] == 0 and groups.nb_bytes[0] == 8);
+    static_assert(groups.group_of_field[4] == 1 and groups.byte_start[1] == 8 and groups.nb_bytes[1] == 1);
+    static_assert(groups.group_of_field[5] == bits::detail::NO_GROUP);
+}
+
+TEST(BitsExtraction_Fields, Extract)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    const auto [val1, val2, val3, val4, val5] = bits::extract_fields<
+        bits::BitsField<uint8_t,  3,   0>,
+        bits::BitsField<int8_t,   13,  6>,
+        bits::BitsField<uint32_t, 59,  30>,
+        bits::BitsField<uint16_t, 71,  60>,
+        bits::BitsField<bits::uint<96>, 127, 32>
+    >(buffer);
+
+    ASSERT_EQ(val1, 0x03);
+    ASSERT_EQ(val2, 0x7F);
+    ASSERT_EQ(val3, (bits::extract<uint32_t>(buffer, 59, 30)));
+    ASSERT_EQ(val4, 0xFCA);
+    ASSERT_EQ(val5, bits::uint<96>(0xFF7035FF, 0xCAFEBABEA5B6C7D8));
+}
+
+TEST(BitsExtraction_Fields, Constexpr)
+{
+    static constexpr auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF);
+
+    static_assert(std::get<1>(bits::extract_fields<bits::BitsField<uint8_t, 3, 0>, bits::BitsField<uint16_t, 23, 8>>(buffer)) == 0xFF70);
+    static_assert(std::get<0>(bits::extract_fields<bits::BitsField<uint8_t, 9, 2>>(bits::lsb_first_little_endian, buffer)) == 0xCD);
+}
+
+//-----------------------------------------------------------------------------
+//- Fields extracted at once should give the same values as extracted one by
+//- one, for every bits order
+//-----------------------------------------------------------------------------
+template<bits::detail::bits_order Order>
+void checkExtractFields(void)
+{
+    const auto buffer = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    if constexpr(Order::swap_bytes)
+    {
+        const auto [val1, val2, val3, val4] = bits::extract_fields<
+            bits::BitsField<uint8_t,  7,   0>,
+            bits::BitsField<int16_t,  39,  24>,
+            bits::BitsField<uint32_t, 71,  40>,
+            bits::BitsField<uint64_t, 127, 64>
+        >(Order{}, buffer);
+
+        ASSERT_EQ(val1, (bits::extract<7,   0,  uint8_t>(Order{}, buffer)));
+        ASSERT_EQ(val2, (bits::extract<39,  24, int16_t>(Order{}, buffer)));
+        ASSERT_EQ(val3, (bits::extract<71,  40, uint32_t>(Order{}, buffer)));
+        ASSERT_EQ(val4, (bits::extract<127, 64, uint64_t>(Order{}, buffer)));
+    }
+    else
+    {
+        const auto [val1, val2, val3, val4, val5, val6] = bits::extract_fields<
+            bits::BitsField<uint8_t,  2,   0>,
+            bits::BitsField<int16_t,  15,  3>,
+            bits::BitsField<uint32_t, 52,  23>,
+            bits::BitsField<bool,     53>,
+            bits::BitsField<int64_t,  116, 54>,
+            bits::BitsField<uint8_t,  127, 121>
+        >(Order{}, buffer);
+
+        ASSERT_EQ(val1, (bits::extract<2,   0,   uint8_t>(Order{}, buffer)));
+        ASSERT_EQ(val2, (bits::extract<15,  3,   int16_t>(Order{}, buffer)));
+        ASSERT_EQ(val3, (bits::extract<52,  23,  uint32_t>(Order{}, buffer)));
+        ASSERT_EQ(val4, (bits::extract<53,  53,  bool>(Order{}, buffer)));
+        ASSERT_EQ(val5, (bits::extract<116, 54,  int64_t>(Order{}, buffer)));
+        ASSERT_EQ(val6, (bits::extract<127, 121, uint8_t>(Order{}, buffer)));
+    }
+}
+
+TEST(BitsExtraction_Fields, SameAsExtract)
+{
+    checkExtractFields<bits::MsbFirstBigEndian>();
+    checkExtractFields<bits::MsbFirstLittleEndian>();
+    checkExtractFields<bits::LsbFirstLittleEndian>();
+    checkExtractFields<bits::LsbFirstBigEndian>();
+}
@@ -17,7 +17,14 @@
 #include <ranges>
 
 #include <bits/detail/Serializer.h>
+#include <bits/detail/StaticSerializer.h>
+#include <bits/detail/bulk_pack.h>
+#include <bits/detail/byte_copy.h>
+#include <bits/detail/StaticDeserializer.h>
+#include <bits/detail/pext_pdep.h>
+#include <bits/detail/wide_integer.h>
 #include <bits/detail/Traits.h>
+#include <bits/BitsOrder.h>
 
 namespace bits {
 
@@ -48,6 +55,39 @@ constexpr void insert(const std::span<std::byte> buffer, R && r);
 template<size_t high, size_t low, std::ranges::input_range R>
 constexpr void insert(const std::span<std::byte> buffer, R && r);
 
+//-----------------------------------------------------------------------------
+//- Insert the low bits of value into the bits selected by a compile time mask
+//- inside a compile time bits range (up to 64 bits), other bits of the range
+//- being preserved (PDEP)
+//-----------------------------------------------------------------------------
+template<uint64_t mask, size_t high, size_t low, detail::input_basic_type T>
+constexpr void insert_mask(const std::span<std::byte> buffer, T val);
+
+//-----------------------------------------------------------------------------
+//- Same as above, with a bits order policy as first parameter
+//- (see BitsOrder.h)
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::input_basic_type T>
+constexpr void insert(Order order, const std::span<std::byte> buffer, T val, size_t high, size_t low);
+template<detail::bits_order Order, std::input_iterator I, std::sentinel_for<I> S>
+constexpr void insert(Order order, const std::span<std::byte> buffer, I first, S last, size_t high, size_t low, size_t nbBitsByElement = sizeof(std::iter_value_t<I>) * CHAR_BIT);
+template<detail::bits_order Order, std::ranges::input_range R>
+constexpr void insert(Order order, const std::span<std::byte> buffer, R && r, size_t high, size_t low, size_t nbBitsByElement = sizeof(std::ranges::range_value_t<R>) * CHAR_BIT);
+
+template<size_t high, size_t low, detail::bits_order Order, detail::input_basic_type T>
+constexpr void insert(Order order, const std::span<std::byte> buffer, T val);
+template<size_t high, size_t low, size_t nbBitsByElement, detail::bits_order Order, std::input_iterator I, std::sentinel_for<I> S>
+constexpr void insert(Order order, const std::span<std::byte> buffer, I first, S last);
+template<size_t high, size_t low, detail::bits_order Order, std::input_iterator I, std::sentinel_for<I> S>
+constexpr void insert(Order order, const std::span<std::byte> buffer, I first, S last);
+template<size_t high, size_t low, size_t nbBitsByElement, detail::bits_order Order, std::ranges::input_range R>
+constexpr void insert(Order order, const std::span<std::byte> buffer, R && r);
+template<size_t high, size_t low, detail::bits_order Order, std::ranges::input_range R>
+constexpr void insert(Order order, const std::span<std::byte> buffer, R && r);
+
+template<uint64_t mask, size_t high, size_t low, detail::bits_order Order, detail::input_basic_type T>
+constexpr void insert_mask(Order order, const std::span<std::byte> buffer, T val);
+
 
 
 
@@ -65,10 +105,10 @@ constexpr void insert(const std::span<std::byte> buffer, R && r);
 //-----------------------------------------------------------------------------
 namespace detail {
 
-template<size_t high, size_t low, size_t nbBitsByElement, std::input_iterator It, std::size_t... I>
-constexpr void insert(const std::span<std::byte> buffer, It first, std::index_sequence<I...>)
+template<size_t high, size_t low, size_t nbBitsByElement, detail::bits_order Order, std::input_iterator It, std::size_t... I>
+constexpr void insert(Order order, const std::span<std::byte> buffer, It first, std::index_sequence<I...>)
 {
-    (bits::insert<(I + 1) * nbBitsByElement + low - 1, I * nbBitsByElement + low>(buffer, *std::next(first, I)), ...);
+    (bits::insert<(I + 1) * nbBitsByElement + low - 1, I * nbBitsByElement + low>(order, buffer, *std::next(first, I)), ...);
 }
 
 } // namespace detail
@@ -80,25 +120,131 @@ constexpr void insert(const std::span<std::byte> buffer, It first, std::index_se
 //-----------------------------------------------------------------------------
 template<detail::input_basic_type T>
 constexpr void insert(const std::span<std::byte> buffer, T val, size_t high, size_t low)
+{
+    insert(DefaultBitsOrder{}, buffer, val, high, low);
+}
+
+//-----------------------------------------------------------------------------
+template<std::input_iterator I, std::sentinel_for<I> S>
+constexpr void insert(const std::span<std::byte> buffer, I first, S last, size_t high, size_t low, size_t nbBitsByElement)
+{
+    insert(DefaultBitsOrder{}, buffer, first, last, high, low, nbBitsByElement);
+}
+
+//-----------------------------------------------------------------------------
+template<std::ranges::input_range R>
+constexpr void insert(const std::span<std::byte> buffer, R && r, size_t high, size_t low, size_t nbBitsByElement)
+{
+    insert(DefaultBitsOrder{}, buffer, std::ranges::begin(r), std::ranges::end(r), high, low, nbBitsByElement);
+}
+
+//-----------------------------------------------------------------------------
+//- Insert value with compile time bits range
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, detail::input_basic_type T>
+constexpr void insert(const std::span<std::byte> buffer, T val)
+{
+    insert<high, low>(DefaultBitsOrder{}, buffer, val);
+}
+
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, size_t nbBitsByElement, std::input_iterator I, std::sentinel_for<I> S>
+constexpr void insert(const std::span<std::byte> buffer, I first, S last)
+{
+    insert<high, low, nbBitsByElement>(DefaultBitsOrder{}, buffer, first, last);
+}
+
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, std::input_iterator I, std::sentinel_for<I> S>
+constexpr void insert(const std::span<std::byte> buffer, I first, S last)
+{
+    insert<high, low, sizeof(std::iter_value_t<I>) * CHAR_BIT>(DefaultBitsOrder{}, buffer, first, last);
+}
+
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, size_t nbBitsByElement, std::ranges::input_range R>
+constexpr void insert(const std::span<std::byte> buffer, R && r)
+{
+    insert<high, low, nbBitsByElement>(DefaultBitsOrder{}, buffer, std::ranges::begin(r), std::ranges::end(r));
+}
+
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, std::ranges::input_range R>
+constexpr void insert(const std::span<std::byte> buffer, R && r)
+{
+    insert<high, low>(DefaultBitsOrder{}, buffer, std::ranges::begin(r), std::ranges::end(r));
+}
+
+//-----------------------------------------------------------------------------
+//- Insert masked bits with compile time bits range
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<uint64_t mask, size_t high, size_t low, detail::input_basic_type T>
+constexpr void insert_mask(const std::span<std::byte> buffer, T val)
+{
+    insert_mask<mask, high, low>(DefaultBitsOrder{}, buffer, val);
+}
+
+//-----------------------------------------------------------------------------
+//- Insert value with runtime bits range and bits order policy
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<detail::bits_order Order, detail::input_basic_type T>
+constexpr void insert(Order, const std::span<std::byte> buffer, T val, size_t high, size_t low)
 {
     assert((buffer.size() * CHAR_BIT) >= (high - low + 1));
     assert((sizeof(T) * CHAR_BIT) >= (high - low + 1));
 
-    const detail::Serializer serializer(high, low);
+    if constexpr(detail::IsWideInteger<T>::value)
+        detail::wide_insert<Order>(buffer, val, high, low);
+    else
+    {
+        const detail::Serializer<Order> serializer(high, low);
 
-    serializer.insert(val, buffer);
+        serializer.insert(val, buffer);
+    }
 }
 
 //-----------------------------------------------------------------------------
-template<std::input_iterator I, std::sentinel_for<I> S>
-constexpr void insert(const std::span<std::byte> buffer, I first, [[maybe_unused]] S last, [[maybe_unused]] size_t high, size_t low, size_t nbBitsByElement)
+template<detail::bits_order Order, std::input_iterator I, std::sentinel_for<I> S>
+constexpr void insert(Order order, const std::span<std::byte> buffer, I first, [[maybe_unused]] S last, [[maybe_unused]] size_t high, size_t low, size_t nbBitsByElement)
 {
     assert((sizeof(std::iter_value_t<I>) * CHAR_BIT) >= nbBitsByElement);
     assert((std::distance(first, last) * sizeof(std::iter_value_t<I>) * CHAR_BIT) >= (high - low + 1));
 
+    // Byte aligned whole bytes elements : plain copy
+    if constexpr(detail::byte_copyable_range<I, S>)
+    {
+        if(detail::is_byte_copy<std::iter_value_t<I>>(low, nbBitsByElement))
+        {
+            const auto nbElements = static_cast<size_t>(last - first);
+            assert(high == (low + nbElements * nbBitsByElement - 1));
+
+            detail::byte_copy_insert<Order::byte_order>(buffer, std::to_address(first), nbElements, low);
+            return;
+        }
+    }
+
+    // Packing from contiguous integers array, each byte being written once
+    if constexpr(detail::bulk_packable_range<Order, I, S>)
+    {
+        if(not std::is_constant_evaluated())
+        {
+            const auto nbElements = static_cast<size_t>(last - first);
+            assert(high == (low + nbElements * nbBitsByElement - 1));
+
+            detail::bulk_pack(buffer, std::to_address(first), nbElements, low, nbBitsByElement);
+            return;
+        }
+    }
+
     while(first != last)
     {
-        insert(buffer, *first, low + nbBitsByElement - 1, low);
+        insert(order, buffer, *first, low + nbBitsByElement - 1, low);
         first++;
         low += nbBitsByElement;
     }
@@ -107,58 +253,83 @@ constexpr void insert(const std::span<std::byte> buffer, I first, [[maybe_unused
 }
 
 //-----------------------------------------------------------------------------
-template<std::ranges::input_range R>
-constexpr void insert(const std::span<std::byte> buffer, R && r, size_t high, size_t low, size_t nbBitsByElement)
+template<detail::bits_order Order, std::ranges::input_range R>
+constexpr void insert(Order order, const std::span<std::byte> buffer, R && r, size_t high, size_t low, size_t nbBitsByElement)
 {
-    insert(buffer, std::ranges::begin(r), std::ranges::end(r), high, low, nbBitsByElement);
+    insert(order, buffer, std::ranges::begin(r), std::ranges::end(r), high, low, nbBitsByElement);
 }
 
 //-----------------------------------------------------------------------------
-//- Insert value with compile time bits range
+//- Insert value with compile time bits range and bits order policy
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-template<size_t high, size_t low, detail::input_basic_type T>
-constexpr void insert(const std::span<std::byte> buffer, T val)
+template<size_t high, size_t low, detail::bits_order Order, detail::input_basic_type T>
+constexpr void insert(Order, const std::span<std::byte> buffer, T val)
 {
     assert((buffer.size() * CHAR_BIT) >= (high - low + 1));
     static_assert((sizeof(T) * CHAR_BIT) >= (high - low + 1));
 
-    constexpr detail::Serializer serializer(high, low);
-
-    serializer.insert(val, buffer);
+    if constexpr(detail::IsWideInteger<T>::value)
+        detail::wide_insert<high, low, Order>(buffer, val);
+    else
+        detail::StaticSerializer<high, low, Order>::insert(val, buffer);
 }
 
 //-----------------------------------------------------------------------------
-template<size_t high, size_t low, size_t nbBitsByElement, std::input_iterator I, std::sentinel_for<I> S>
-constexpr void insert(const std::span<std::byte> buffer, I first, [[maybe_unused]] S last)
+template<size_t high, size_t low, size_t nbBitsByElement, detail::bits_order Order, std::input_iterator I, std::sentinel_for<I> S>
+constexpr void insert(Order order, const std::span<std::byte> buffer, I first, [[maybe_unused]] S last)
 {
     constexpr auto nElems = (high - low + 1) / nbBitsByElement;
     static_assert((sizeof(std::iter_value_t<I>) * CHAR_BIT) >= nbBitsByElement);
     assert(static_cast<size_t>(std::distance(first, last)) >= nElems);
 
-    detail::insert<high, low, nbBitsByElement>(buffer, first, std::make_index_sequence<nElems>());
+    if constexpr(detail::byte_copyable_range<I, I> and detail::is_byte_copy<std::iter_value_t<I>>(low, nbBitsByElement))
+        detail::byte_copy_insert<Order::byte_order>(buffer, std::to_address(first), nElems, low);
+    else
+        detail::insert<high, low, nbBitsByElement>(order, buffer, first, std::make_index_sequence<nElems>());
 }
 
 //-----------------------------------------------------------------------------
-template<size_t high, size_t low, std::input_iterator I, std::sentinel_for<I> S>
-constexpr void insert(const std::span<std::byte> buffer, I first, S last)
+template<size_t high, size_t low, detail::bits_order Order, std::input_iterator I, std::sentinel_for<I> S>
+constexpr void insert(Order order, const std::span<std::byte> buffer, I first, S last)
 {
-    insert<high, low, sizeof(std::iter_value_t<I>) * CHAR_BIT>(buffer, first, last);
+    insert<high, low, sizeof(std::iter_value_t<I>) * CHAR_BIT>(order, buffer, first, last);
 }
 
 //-----------------------------------------------------------------------------
-template<size_t high, size_t low, size_t nbBitsByElement, std::ranges::input_range R>
-constexpr void insert(const std::span<std::byte> buffer, R && r)
+template<size_t high, size_t low, size_t nbBitsByElement, detail::bits_order Order, std::ranges::input_range R>
+constexpr void insert(Order order, const std::span<std::byte> buffer, R && r)
 {
-    insert<high, low, nbBitsByElement>(buffer, std::ranges::begin(r), std::ranges::end(r));
+    insert<high, low, nbBitsByElement>(order, buffer, std::ranges::begin(r), std::ranges::end(r));
 }
 
 //-----------------------------------------------------------------------------
-template<size_t high, size_t low, std::ranges::input_range R>
-constexpr void insert(const std::span<std::byte> buffer, R && r)
+template<size_t high, size_t low, detail::bits_order Order, std::ranges::input_range R>
+constexpr void insert(Order order, const std::span<std::byte> buffer, R && r)
+{
+    insert<high, low>(order, buffer, std::ranges::begin(r), std::ranges::end(r));
+}
+
+//-----------------------------------------------------------------------------
+//- Insert masked bits with compile time bits range and bits order policy
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<uint64_t mask, size_t high, size_t low, detail::bits_order Order, detail::input_basic_type T>
+constexpr void insert_mask(Order, const std::span<std::byte> buffer, T val)
 {
-    insert<high, low>(buffer, std::ranges::begin(r), std::ranges::end(r));
+    static_assert((high - low + 1) >= 64 or (mask >> (high - low + 1)) == 0, "Mask should be within the bits range");
+    static_assert((sizeof(T) * CHAR_BIT) >= static_cast<size_t>(std::popcount(mask)));
+    assert((buffer.size() * CHAR_BIT) > high);
+
+    uint64_t window;
+    detail::StaticDeserializer<high, low, Order>::extract(buffer, window);
+
+    const auto rawVal = static_cast<detail::word_t>(static_cast<detail::underlying_integral_type_t<T>>(val));
+    window = (window & ~mask) | detail::pdep<mask>(rawVal);
+
+    detail::StaticSerializer<high, low, Order>::insert(window, buffer);
 }
 
 } // namespace bits
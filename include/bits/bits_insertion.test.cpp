@@ -13,6 +13,8 @@
 #include <list>
 
 #include <bits/bits_insertion.h>
+#include <bits/Uint.h>
+#include <bits/detail/bulk_pack.h>
 
 using ::testing::ElementsAreArray;
 
@@ -179,7 +181,7 @@ TEST(BitsInsertion_CppArray, Signed_32bits_empty_buffer)
     bits::insert<int32_t>(buffer,      -1, 5,  4 ); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)));
     bits::insert<int32_t>(buffer,      63, 13, 6 ); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)));
     bits::insert<int32_t>(buffer,   -7204, 27, 14); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDC, 0xFE, 0x3D, 0xC0, 0x00, 0x00, 0x00, 0x00)));
-    bits::insert<int32_t>(buffer, -573553, 53, 28); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDC, 0xFE, 0x3D, 0xFF, 0xDC, 0xFE, 0x3C, 0x00)));
+    bits::insert<int32_t>(buffer, -573553, 53, 28); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDC, 0xFE, 0x3D, 0xCF, 0xDC, 0xFE, 0x3C, 0x00)));
 }
 
 TEST(BitsInsertion_CppArray, Signed_8bits_no_empty_buffer)
@@ -211,7 +213,27 @@ TEST(BitsInsertion_CppArray, Signed_32bits_no_empty_buffer)
     bits::insert<int32_t>(buffer,      -1, 5,  4 ); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF)));
     bits::insert<int32_t>(buffer,      63, 13, 6 ); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF)));
     bits::insert<int32_t>(buffer,   -7204, 27, 14); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDC, 0xFE, 0x3D, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF)));
-    bits::insert<int32_t>(buffer, -573553, 53, 28); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDC, 0xFE, 0x3D, 0xFF, 0xDC, 0xFE, 0x3F, 0xFF)));
+    bits::insert<int32_t>(buffer, -573553, 53, 28); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDC, 0xFE, 0x3D, 0xCF, 0xDC, 0xFE, 0x3F, 0xFF)));
+}
+
+TEST(BitsInsertion_CppArray, Word_kernel_empty_buffer)
+{
+    auto buffer = make_array(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00);
+
+    bits::insert<uint32_t>(buffer, 0xFDC0D7FD,            41,  10); ASSERT_THAT(buffer, ElementsAreArray(make_array(0x00, 0x3F, 0x70, 0x35, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)));
+    bits::insert<int64_t> (buffer, -158097755589121,      63,  7 ); ASSERT_THAT(buffer, ElementsAreArray(make_array(0x01, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)));
+    bits::insert<uint64_t>(buffer, 0xAFFB'81AF'FB81'AFFE, 66,  3 ); ASSERT_THAT(buffer, ElementsAreArray(make_array(0x15, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)));
+    bits::insert<uint32_t>(buffer, 0xA5B6C7D8,            127, 96); ASSERT_THAT(buffer, ElementsAreArray(make_array(0x15, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xA5, 0xB6, 0xC7, 0xD8)));
+}
+
+TEST(BitsInsertion_CppArray, Word_kernel_no_empty_buffer)
+{
+    auto buffer = make_array(0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF);
+
+    bits::insert<uint32_t>(buffer, 0xFDC0D7FD,            41,  10); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xFF, 0xFF, 0x70, 0x35, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF)));
+    bits::insert<int64_t> (buffer, -158097755589121,      63,  7 ); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xFF, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF)));
+    bits::insert<uint64_t>(buffer, 0xAFFB'81AF'FB81'AFFE, 66,  3 ); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xF5, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF)));
+    bits::insert<uint32_t>(buffer, 0xA5B6C7D8,            127, 96); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xF5, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xA5, 0xB6, 0xC7, 0xD8)));
 }
 
 TEST(BitsInsertion_CppArray, Ranges)
@@ -492,7 +514,7 @@ TEST(BitsInsertion_CppArray, TemplatedPosition_Signed_32bits_empty_buffer)
     bits::insert<5,  4,  int32_t>(buffer,      -1); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)));
     bits::insert<13, 6,  int32_t>(buffer,      63); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)));
     bits::insert<27, 14, int32_t>(buffer,   -7204); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDC, 0xFE, 0x3D, 0xC0, 0x00, 0x00, 0x00, 0x00)));
-    bits::insert<53, 28, int32_t>(buffer, -573553); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDC, 0xFE, 0x3D, 0xFF, 0xDC, 0xFE, 0x3C, 0x00)));
+    bits::insert<53, 28, int32_t>(buffer, -573553); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDC, 0xFE, 0x3D, 0xCF, 0xDC, 0xFE, 0x3C, 0x00)));
 }
 
 TEST(BitsInsertion_CppArray, TemplatedPosition_Signed_8bits_no_empty_buffer)
@@ -524,7 +546,27 @@ TEST(BitsInsertion_CppArray, TemplatedPosition_Signed_32bits_no_empty_buffer)
     bits::insert<5,  4,  int32_t>(buffer,      -1); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF)));
     bits::insert<13, 6,  int32_t>(buffer,      63); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF)));
     bits::insert<27, 14, int32_t>(buffer,   -7204); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDC, 0xFE, 0x3D, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF)));
-    bits::insert<53, 28, int32_t>(buffer, -573553); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDC, 0xFE, 0x3D, 0xFF, 0xDC, 0xFE, 0x3F, 0xFF)));
+    bits::insert<53, 28, int32_t>(buffer, -573553); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xDC, 0xFE, 0x3D, 0xCF, 0xDC, 0xFE, 0x3F, 0xFF)));
+}
+
+TEST(BitsInsertion_CppArray, TemplatedPosition_Word_kernel_empty_buffer)
+{
+    auto buffer = make_array(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00);
+
+    bits::insert<41,  10, uint32_t>(buffer, 0xFDC0D7FD);            ASSERT_THAT(buffer, ElementsAreArray(make_array(0x00, 0x3F, 0x70, 0x35, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)));
+    bits::insert<63,  7,  int64_t> (buffer, -158097755589121);      ASSERT_THAT(buffer, ElementsAreArray(make_array(0x01, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)));
+    bits::insert<66,  3,  uint64_t>(buffer, 0xAFFB'81AF'FB81'AFFE); ASSERT_THAT(buffer, ElementsAreArray(make_array(0x15, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)));
+    bits::insert<127, 96, uint32_t>(buffer, 0xA5B6C7D8);            ASSERT_THAT(buffer, ElementsAreArray(make_array(0x15, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xA5, 0xB6, 0xC7, 0xD8)));
+}
+
+TEST(BitsInsertion_CppArray, TemplatedPosition_Word_kernel_no_empty_buffer)
+{
+    auto buffer = make_array(0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF);
+
+    bits::insert<41,  10, uint32_t>(buffer, 0xFDC0D7FD);            ASSERT_THAT(buffer, ElementsAreArray(make_array(0xFF, 0xFF, 0x70, 0x35, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF)));
+    bits::insert<63,  7,  int64_t> (buffer, -158097755589121);      ASSERT_THAT(buffer, ElementsAreArray(make_array(0xFF, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF)));
+    bits::insert<66,  3,  uint64_t>(buffer, 0xAFFB'81AF'FB81'AFFE); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xF5, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF)));
+    bits::insert<127, 96, uint32_t>(buffer, 0xA5B6C7D8);            ASSERT_THAT(buffer, ElementsAreArray(make_array(0xF5, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xA5, 0xB6, 0xC7, 0xD8)));
 }
 
 TEST(BitsInsertion_CppArray, TemplatedPosition_Ranges)
@@ -642,4 +684,410 @@ TEST(BitsInsertion_CppArray, TemplatedPosition_Ranges_Small_Values)
         bits::insert<15, 4, 4>(buffer, std_list);
         ASSERT_THAT(buffer, ElementsAreArray(make_array(0xF5, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF)));
     }
-}
\ No newline at end of file
+}
+TEST(BitsInsertion_BitsOrder, LsbFirst_LittleEndian)
+{
+    const auto expected = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    for(auto fill : { std::byte(0x00), std::byte(0xFF) })
+    {
+        std::array<std::byte, 16> buffer;
+        buffer.fill(fill);
+
+        bits::insert(bits::lsb_first_little_endian, buffer, uint8_t (0x5),                3,   0  );
+        bits::insert(bits::lsb_first_little_endian, buffer, uint16_t(0x3F3),              13,  4  );
+        bits::insert(bits::lsb_first_little_endian, buffer, uint64_t(0x2BFCD5C3FCD5C3),   67,  14 );
+        bits::insert(bits::lsb_first_little_endian, buffer, int16_t (0x1EC - 0x200),      76,  68 );
+        bits::insert(bits::lsb_first_little_endian, buffer, uint32_t(0x2DF5D7),           99,  77 );
+        bits::insert(bits::lsb_first_little_endian, buffer, uint32_t(0xD8C7B6A),          127, 100);
+        ASSERT_THAT(buffer, ElementsAreArray(expected));
+    }
+}
+
+TEST(BitsInsertion_BitsOrder, LsbFirst_BigEndian)
+{
+    const auto expected = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    for(auto fill : { std::byte(0x00), std::byte(0xFF) })
+    {
+        std::array<std::byte, 16> buffer;
+        buffer.fill(fill);
+
+        bits::insert(bits::lsb_first_little_endian, buffer, uint8_t (0x5),                3,   0  );
+        bits::insert(bits::lsb_first_big_endian,    buffer, uint64_t(0xF30F57F30F57F3AF), 67,  4  );
+        bits::insert(bits::lsb_first_big_endian,    buffer, uint32_t(0xECAFEB),           91,  68 );
+        bits::insert(bits::lsb_first_big_endian,    buffer, uint32_t(0x5B6A7B8C),         123, 92 );
+        bits::insert(bits::lsb_first_little_endian, buffer, uint8_t (0xD),                127, 124);
+        ASSERT_THAT(buffer, ElementsAreArray(expected));
+    }
+}
+
+TEST(BitsInsertion_BitsOrder, MsbFirst_LittleEndian)
+{
+    const auto expected = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    for(auto fill : { std::byte(0x00), std::byte(0xFF) })
+    {
+        std::array<std::byte, 16> buffer;
+        buffer.fill(fill);
+
+        bits::insert(                               buffer, uint8_t (0x3),                3,   0  );
+        bits::insert(bits::msb_first_little_endian, buffer, uint64_t(0xFC5F03F75F03F75F), 67,  4  );
+        bits::insert(bits::msb_first_little_endian, buffer, uint32_t(0xABEBAF),           91,  68 );
+        bits::insert(bits::msb_first_little_endian, buffer, uint8_t (0xEA),               99,  92 );
+        bits::insert(bits::msb_first_little_endian, buffer, int32_t (0x7D6C5B),           123, 100);
+        bits::insert(bits::msb_first_big_endian,    buffer, uint8_t (0x8),                127, 124);
+        ASSERT_THAT(buffer, ElementsAreArray(expected));
+    }
+}
+
+TEST(BitsInsertion_BitsOrder, TemplatedPosition)
+{
+    const auto expected = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    for(auto fill : { std::byte(0x00), std::byte(0xFF) })
+    {
+        std::array<std::byte, 16> buffer;
+        buffer.fill(fill);
+
+        bits::insert<3,   0  >(bits::lsb_first_little_endian, buffer, uint8_t (0x5));
+        bits::insert<13,  4  >(bits::lsb_first_little_endian, buffer, uint16_t(0x3F3));
+        bits::insert<67,  14 >(bits::lsb_first_little_endian, buffer, uint64_t(0x2BFCD5C3FCD5C3));
+        bits::insert<76,  68 >(bits::lsb_first_little_endian, buffer, int16_t (0x1EC - 0x200));
+        bits::insert<99,  77 >(bits::lsb_first_little_endian, buffer, uint32_t(0x2DF5D7));
+        bits::insert<127, 100>(bits::lsb_first_little_endian, buffer, uint32_t(0xD8C7B6A));
+        ASSERT_THAT(buffer, ElementsAreArray(expected));
+
+        buffer.fill(fill);
+        bits::insert<3,   0  >(bits::lsb_first_little_endian, buffer, uint8_t (0x5));
+        bits::insert<67,  4  >(bits::lsb_first_big_endian,    buffer, uint64_t(0xF30F57F30F57F3AF));
+        bits::insert<91,  68 >(bits::lsb_first_big_endian,    buffer, uint32_t(0xECAFEB));
+        bits::insert<123, 92 >(bits::lsb_first_big_endian,    buffer, uint32_t(0x5B6A7B8C));
+        bits::insert<127, 124>(bits::lsb_first_little_endian, buffer, uint8_t (0xD));
+        ASSERT_THAT(buffer, ElementsAreArray(expected));
+
+        buffer.fill(fill);
+        bits::insert<3,   0  >(                               buffer, uint8_t (0x3));
+        bits::insert<67,  4  >(bits::msb_first_little_endian, buffer, uint64_t(0xFC5F03F75F03F75F));
+        bits::insert<91,  68 >(bits::msb_first_little_endian, buffer, uint32_t(0xABEBAF));
+        bits::insert<99,  92 >(bits::msb_first_little_endian, buffer, uint8_t (0xEA));
+        bits::insert<123, 100>(bits::msb_first_little_endian, buffer, int32_t (0x7D6C5B));
+        bits::insert<127, 124>(bits::msb_first_big_endian,    buffer, uint8_t (0x8));
+        ASSERT_THAT(buffer, ElementsAreArray(expected));
+    }
+}
+
+TEST(BitsInsertion_BitsOrder, Ranges)
+{
+    std::array<std::byte, 8> buffer = {};
+    const std::array<uint16_t, 4> values = { 0xFF35, 0x3570, 0x70FF, 0xFF35 };
+
+    bits::insert(bits::msb_first_little_endian, buffer, values, 63, 0);
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF)));
+
+    buffer = {};
+    bits::insert<63, 0>(bits::lsb_first_little_endian, buffer, values);
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF)));
+}
+
+//-----------------------------------------------------------------------------
+//- Bulk packing kernels should be bit for bit identical to the element by
+//- element insertion, and preserve the bits around the inserted range
+//-----------------------------------------------------------------------------
+template<typename T>
+void checkBulkPack(void)
+{
+    uint32_t seed = 0x12345678;
+    auto random = [&seed]() { seed = seed * 1664525u + 1013904223u; return seed; };
+
+    std::vector<std::byte> initial(300);
+    for(auto & byte : initial)
+        byte = std::byte(random() >> 24);
+
+    std::vector<T> values(200);
+    for(auto & value : values)
+        value = static_cast<T>((uint64_t(random()) << 32) | random());
+
+    for(size_t nbBits = 1; nbBits <= sizeof(T) * CHAR_BIT; nbBits++)
+    {
+        for(size_t low : { 0, 1, 5, 7, 12, 19 })
+        {
+            for(size_t nbElements : { size_t(0), size_t(1), size_t(7), size_t(11), std::min<size_t>(values.size(), (initial.size() * CHAR_BIT - low) / nbBits) })
+            {
+                const auto elements = std::span<const T>(values).subspan(0, nbElements);
+                const size_t high = low + nbElements * nbBits - 1;
+
+                auto expected = initial;
+                for(size_t i = 0; i < nbElements; i++)
+                    bits::insert(expected, elements[i], low + (i + 1) * nbBits - 1, low + i * nbBits);
+
+                auto buffer = initial;
+                bits::insert(buffer, elements, high, low, nbBits);
+                ASSERT_EQ(buffer, expected) << "nbBits=" << nbBits << " low=" << low << " nbElements=" << nbElements;
+
+                buffer = initial;
+                bits::detail::bulk_pack_scalar(std::span(buffer), elements.data(), nbElements, low, nbBits);
+                ASSERT_EQ(buffer, expected) << "scalar nbBits=" << nbBits << " low=" << low << " nbElements=" << nbElements;
+
+#if BITS_X86_SIMD
+                if(nbBits > bits::detail::BULK_PACK_SIMD_MAX_BITS)
+                    continue;
+                if(bits::detail::cpu_features().sse42)
+                {
+                    buffer = initial;
+                    bits::detail::bulk_pack_sse42(std::span(buffer), elements.data(), nbElements, low, nbBits);
+                    ASSERT_EQ(buffer, expected) << "sse4.2 nbBits=" << nbBits << " low=" << low << " nbElements=" << nbElements;
+                }
+                if(bits::detail::cpu_features().avx2)
+                {
+                    buffer = initial;
+                    bits::detail::bulk_pack_avx2(std::span(buffer), elements.data(), nbElements, low, nbBits);
+                    ASSERT_EQ(buffer, expected) << "avx2 nbBits=" << nbBits << " low=" << low << " nbElements=" << nbElements;
+                }
+#endif
+            }
+        }
+    }
+}
+
+TEST(BitsInsertion_Bulk, Unsigned)
+{
+    checkBulkPack<uint8_t>();
+    checkBulkPack<uint16_t>();
+    checkBulkPack<uint32_t>();
+    checkBulkPack<uint64_t>();
+}
+
+TEST(BitsInsertion_Bulk, Signed)
+{
+    checkBulkPack<int8_t>();
+    checkBulkPack<int16_t>();
+    checkBulkPack<int32_t>();
+    checkBulkPack<int64_t>();
+}
+
+TEST(BitsInsertion_Mask, Unsigned)
+{
+    const auto expected = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    for(auto fill : { std::byte(0x00), std::byte(0xFF) })
+    {
+        std::array<std::byte, 16> buffer;
+        buffer.fill(fill);
+
+        bits::insert_mask<0x7,                2,   0  >(buffer, uint8_t (0x1));
+        bits::insert_mask<0xF0F0F0F0F0F0F0F0, 66,  3  >(buffer, uint32_t(0xAF8AF8AF));
+        bits::insert_mask<0x0F0F0F0F0F0F0F0F, 66,  3  >(buffer, uint32_t(0xFB1FB1FE));
+        bits::insert_mask<0x1FFFFFFF,         95,  67 >(buffer, uint32_t(0xAFEBABE));
+        bits::insert_mask<0x00FF00FF,         127, 96 >(buffer, uint16_t(0xB6D8));
+        bits::insert_mask<0xFF00FF00,         127, 96 >(buffer, uint16_t(0xA5C7));
+        ASSERT_THAT(buffer, ElementsAreArray(expected));
+    }
+}
+
+TEST(BitsInsertion_Mask, Preserve_unmasked_bits)
+{
+    auto buffer = make_array(0x35, 0xFF, 0x70, 0x35);
+
+    bits::insert_mask<0x0FF0, 15, 0>(buffer, uint8_t(0xA5)); ASSERT_THAT(buffer, ElementsAreArray(make_array(0x3A, 0x5F, 0x70, 0x35)));
+    bits::insert_mask<0x8001, 15, 0>(buffer, uint8_t(0x2));  ASSERT_THAT(buffer, ElementsAreArray(make_array(0xBA, 0x5E, 0x70, 0x35)));
+    bits::insert_mask<0x0101, 23, 8>(buffer, uint8_t(0x0));  ASSERT_THAT(buffer, ElementsAreArray(make_array(0xBA, 0x5E, 0x70, 0x35)));
+}
+
+TEST(BitsInsertion_Mask, Signed)
+{
+    auto buffer = make_array(0x00, 0x00, 0x00, 0x00);
+
+    bits::insert_mask<0x00F0,     15, 0 >(buffer, int8_t (-1));   ASSERT_THAT(buffer, ElementsAreArray(make_array(0x00, 0xF0, 0x00, 0x00)));
+    bits::insert_mask<0xFF0000FF, 31, 0 >(buffer, int16_t(-515)); ASSERT_THAT(buffer, ElementsAreArray(make_array(0xFD, 0xF0, 0x00, 0xFD)));
+}
+
+TEST(BitsInsertion_Mask, Constexpr)
+{
+    constexpr auto buffer = [] {
+        auto buffer = make_array(0x00, 0x00, 0x00, 0x00);
+        bits::insert_mask<0xF00F,     15, 0>(buffer, uint8_t(0x3F));
+        bits::insert_mask<0xFF0000FF, 31, 0>(buffer, int16_t(-515));
+        return buffer;
+    }();
+
+    static_assert(buffer[0] == std::byte(0xFD) and buffer[1] == std::byte(0x0F) and buffer[2] == std::byte(0x00) and buffer[3] == std::byte(0xFD));
+}
+
+TEST(BitsInsertion_Mask, BitsOrder)
+{
+    auto buffer = make_array(0x00, 0x00);
+
+    bits::insert_mask<0x0FF0, 15, 0>(bits::lsb_first_little_endian, buffer, uint8_t(0xF3)); ASSERT_THAT(buffer, ElementsAreArray(make_array(0x30, 0x0F)));
+    bits::insert_mask<0x0FF0, 15, 0>(bits::msb_first_little_endian, buffer, uint8_t(0xA5)); ASSERT_THAT(buffer, ElementsAreArray(make_array(0x50, 0x0A)));
+    bits::insert_mask<0x0FF0, 15, 0>(bits::msb_first_big_endian,    buffer, uint8_t(0xF3)); ASSERT_THAT(buffer, ElementsAreArray(make_array(0x5F, 0x3A)));
+}
+
+TEST(BitsInsertion_ByteAligned, Ranges_Bytes)
+{
+    const auto mac = make_array(0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35);
+
+    for(auto fill : { std::byte(0x00), std::byte(0xFF) })
+    {
+        std::array<std::byte, 8> buffer;
+
+        buffer.fill(fill);
+        bits::insert(buffer, mac, 55, 8);
+        ASSERT_THAT(buffer, ElementsAreArray(make_array(fill, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, fill)));
+
+        buffer.fill(fill);
+        bits::insert(bits::lsb_first_little_endian, buffer, std::vector<uint8_t>{ 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35 }, 63, 16);
+        ASSERT_THAT(buffer, ElementsAreArray(make_array(fill, fill, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35)));
+
+        buffer.fill(fill);
+        bits::insert<55, 8>(buffer, mac);
+        ASSERT_THAT(buffer, ElementsAreArray(make_array(fill, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, fill)));
+    }
+}
+
+TEST(BitsInsertion_ByteAligned, Ranges_Words)
+{
+    const std::array<uint16_t, 3> words = { 0x7035, 0xFF70, 0xCAFE };
+
+    std::array<std::byte, 8> buffer = {};
+    bits::insert(buffer, words, 63, 16);
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0x00, 0x00, 0x70, 0x35, 0xFF, 0x70, 0xCA, 0xFE)));
+    bits::insert(bits::msb_first_little_endian, buffer, words, 63, 16);
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0x00, 0x00, 0x35, 0x70, 0x70, 0xFF, 0xFE, 0xCA)));
+    bits::insert(bits::lsb_first_big_endian, buffer, words, 55, 8);
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0x00, 0x70, 0x35, 0xFF, 0x70, 0xCA, 0xFE, 0xCA)));
+    bits::insert<55, 8>(bits::lsb_first_little_endian, buffer, words);
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0x00, 0x35, 0x70, 0x70, 0xFF, 0xFE, 0xCA, 0xCA)));
+
+    const std::array<int32_t, 2> dwords = { int32_t(0xCAFEBABE), int32_t(0xA5B6C7D8) };
+    bits::insert<63, 0>(buffer, dwords);
+    ASSERT_THAT(buffer, ElementsAreArray(make_array(0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8)));
+}
+
+TEST(BitsInsertion_ByteAligned, Constexpr)
+{
+    constexpr auto buffer = [] {
+        std::array<std::byte, 8> buffer = {};
+        bits::insert<31, 0>(buffer, std::array<uint16_t, 2>{ 0xCAFE, 0xBABE });
+        bits::insert<63, 32>(bits::msb_first_little_endian, buffer, std::array<uint16_t, 2>{ 0xCAFE, 0xBABE });
+        return buffer;
+    }();
+
+    static_assert(buffer[0] == std::byte(0xCA) and buffer[3] == std::byte(0xBE) and buffer[4] == std::byte(0xFE) and buffer[7] == std::byte(0xBA));
+}
+
+TEST(BitsInsertion_ByteAligned, Buffer_tail)
+{
+    for(auto fill : { std::byte(0x00), std::byte(0xFF) })
+    {
+        std::array<std::byte, 8> buffer;
+        buffer.fill(fill);
+
+        bits::insert(buffer, uint64_t(0xFEBABEA5B6C7D8), 63, 8);
+        ASSERT_THAT(buffer, ElementsAreArray(make_array(fill, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8)));
+        bits::insert(buffer, int32_t(-4798504), 63, 40);
+        ASSERT_THAT(buffer, ElementsAreArray(make_array(fill, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8)));
+        bits::insert(bits::msb_first_little_endian, buffer, uint32_t(0xB6C7D8), 63, 40);
+        ASSERT_THAT(buffer, ElementsAreArray(make_array(fill, 0xFE, 0xBA, 0xBE, 0xA5, 0xD8, 0xC7, 0xB6)));
+    }
+}
+
+#if BITS_HAS_INT128
+constexpr bits::detail::uint128_t make_uint128(uint64_t high, uint64_t low) noexcept
+{
+    return (bits::detail::uint128_t(high) << 64) | low;
+}
+
+TEST(BitsInsertion_Wide, Int128)
+{
+    using bits::detail::uint128_t;
+    using bits::detail::int128_t;
+    const auto expected = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    for(auto fill : { std::byte(0x00), std::byte(0xFF) })
+    {
+        std::array<std::byte, 16> buffer;
+
+        buffer.fill(fill);
+        bits::insert(buffer, uint128_t(make_uint128(0x35FF7035FF7035FF, 0xCAFEBABEA5B6C7D8)), 127, 0);
+        ASSERT_THAT(buffer, ElementsAreArray(expected));
+
+        buffer.fill(fill);
+        bits::insert(buffer, uint8_t(0x1), 2, 0);
+        bits::insert(buffer, make_uint128(0x0AFFB81AFFB81AFF, 0xE57F5D5F52DB63EC), 126, 3);
+        bits::insert(buffer, uint8_t(0x0), 127, 127);
+        ASSERT_THAT(buffer, ElementsAreArray(expected));
+
+        buffer.fill(fill);
+        bits::insert<7,   0>(buffer, uint8_t(0x35));
+        bits::insert<127, 8>(buffer, int128_t(make_uint128(0xFFFF7035FF7035FF, 0xCAFEBABEA5B6C7D8)));
+        ASSERT_THAT(buffer, ElementsAreArray(expected));
+    }
+}
+
+TEST(BitsInsertion_Wide, Int128_BitsOrder)
+{
+    using bits::detail::uint128_t;
+    using bits::detail::int128_t;
+    const auto expected = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    for(auto fill : { std::byte(0x00), std::byte(0xFF) })
+    {
+        std::array<std::byte, 16> buffer;
+
+        buffer.fill(fill);
+        bits::insert(bits::lsb_first_little_endian, buffer, uint8_t(0x5), 2, 0);
+        bits::insert(bits::lsb_first_little_endian, buffer, make_uint128(0x0B18F6D4B7D75FD9, 0x5FE6AE1FE6AE1FE6), 126, 3);
+        bits::insert(bits::lsb_first_little_endian, buffer, uint8_t(0x1), 127, 127);
+        ASSERT_THAT(buffer, ElementsAreArray(expected));
+
+        buffer.fill(fill);
+        bits::insert<7,   0>(bits::msb_first_little_endian, buffer, uint8_t(0x35));
+        bits::insert<127, 8>(bits::msb_first_little_endian, buffer, int128_t(make_uint128(0xFFD8C7B6A5BEBAFE, 0xCAFF3570FF3570FF)));
+        ASSERT_THAT(buffer, ElementsAreArray(expected));
+
+        buffer.fill(fill);
+        bits::insert<126, 3>(bits::lsb_first_little_endian, buffer, make_uint128(0x0B18F6D4B7D75FD9, 0x5FE6AE1FE6AE1FE6));
+        bits::insert<2,   0>(bits::lsb_first_little_endian, buffer, uint8_t(0x5));
+        bits::insert<127, 127>(bits::lsb_first_little_endian, buffer, uint8_t(0x1));
+        ASSERT_THAT(buffer, ElementsAreArray(expected));
+
+        buffer.fill(fill);
+        bits::insert(bits::lsb_first_big_endian, buffer, make_uint128(0x35FF7035FF7035FF, 0xCAFEBABEA5B6C7D8), 127, 0);
+        ASSERT_THAT(buffer, ElementsAreArray(expected));
+    }
+}
+#endif
+
+TEST(BitsInsertion_Wide, Uint)
+{
+    const auto expected = make_array(0x35, 0xFF, 0x70, 0x35, 0xFF, 0x70, 0x35, 0xFF, 0xCA, 0xFE, 0xBA, 0xBE, 0xA5, 0xB6, 0xC7, 0xD8);
+
+    for(auto fill : { std::byte(0x00), std::byte(0xFF) })
+    {
+        std::array<std::byte, 16> buffer;
+
+        buffer.fill(fill);
+        bits::insert(buffer, uint32_t(0x35FF7035), 31, 0);
+        bits::insert(buffer, bits::uint<96>(0xFF7035FF, 0xCAFEBABEA5B6C7D8), 127, 32);
+        ASSERT_THAT(buffer, ElementsAreArray(expected));
+
+        buffer.fill(fill);
+        bits::insert<3,   0 >(buffer, uint8_t(0x3));
+        bits::insert<75,  4 >(buffer, bits::uint<72>(0x5F, 0xF7035FF7035FFCAF));
+        bits::insert<127, 76>(buffer, uint64_t(0xEBABEA5B6C7D8));
+        ASSERT_THAT(buffer, ElementsAreArray(expected));
+
+        buffer.fill(fill);
+        bits::insert<31,  0 >(buffer, uint32_t(0x35FF7035));
+        bits::insert<127, 32>(bits::msb_first_little_endian, buffer, bits::uint<96>(0xD8C7B6A5, 0xBEBAFECAFF3570FF));
+        ASSERT_THAT(buffer, ElementsAreArray(expected));
+    }
+
+    constexpr auto constBuffer = [] {
+        std::array<std::byte, 16> buffer = {};
+        bits::insert<127, 0>(buffer, bits::uint<128>(0x35FF7035FF7035FF, 0xCAFEBABEA5B6C7D8));
+        return buffer;
+    }();
+    static_assert(constBuffer[0] == std::byte(0x35) and constBuffer[8] == std::byte(0xCA) and constBuffer[15] == std::byte(0xD8));
+}
@@ -11,6 +11,8 @@
 #include <cstddef>
 #include <cstdlib>
 
+#include <bits/detail/word_access.h>
+
 namespace bits::detail {
 
 //-----------------------------------------------------------------------------
@@ -23,10 +25,14 @@ public:
 
 protected:
     inline constexpr bool isSameByte(void) const noexcept;
+    inline constexpr bool isSingleWord(void) const noexcept;
+    inline constexpr bool isByteAligned(void) const noexcept;
 
     const size_t byte_start;
     const size_t byte_end;
     const size_t first_byte_shift;
+    const size_t nb_bits;
+    const size_t word_first_bit;
 };
 
 
@@ -42,12 +48,15 @@ inline static constexpr size_t    num_byte(size_t bit)                { return b
 inline static constexpr std::byte mask_8bits(size_t bit)              { return std::byte((1 << (8 - (bit % 8))) - 1); }
 inline static constexpr std::byte mask_8bits(size_t low, size_t high) { return std::byte((1 << (((high - low) % 8) + 1)) - 1); }
 inline static constexpr size_t    first_byte_shift_8bits(size_t bit)  { return 7 - (bit % 8); }
+inline static constexpr size_t    nb_bits_field(size_t low, size_t high) { return high - low + 1; }
 
 //-----------------------------------------------------------------------------
 inline constexpr BaseSerialization::BaseSerialization(size_t high, size_t low) noexcept
 : byte_start { detail::num_byte(low) }
 , byte_end   { detail::num_byte(high) }
 , first_byte_shift { detail::first_byte_shift_8bits(high) }
+, nb_bits { detail::nb_bits_field(low, high) }
+, word_first_bit { low % 8 }
 {}
 
 //-----------------------------------------------------------------------------
@@ -56,6 +65,18 @@ inline constexpr bool BaseSerialization::isSameByte(void) const noexcept
     return byte_start == byte_end;
 }
 
+//-----------------------------------------------------------------------------
+inline constexpr bool BaseSerialization::isSingleWord(void) const noexcept
+{
+    return (word_first_bit + nb_bits) <= WORD_BITS;
+}
+
+//-----------------------------------------------------------------------------
+inline constexpr bool BaseSerialization::isByteAligned(void) const noexcept
+{
+    return word_first_bit == 0 and (nb_bits % 8) == 0;
+}
+
 } // namespace bits::detail
 
 #endif /* BITS_DETAIL_BASE_SERIALIZATION_H */
\ No newline at end of file
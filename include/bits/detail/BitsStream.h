@@ -8,18 +8,33 @@
 #define BITS_DETAIL_BITS_STREAM_H
 
 #include <cstdint>
+#include <climits>
 #include <cstdlib>
 #include <stdexcept>
 #include <string_view>
 
 #include <bits/detail/BitsStreamManipulation.h>
+#include <bits/BoundsCheck.h>
 
 namespace bits::detail {
 
 //-----------------------------------------------------------------------------
-//- Bits serializer / deserializer base class for common operations
+//- Position of a bits stream saved by 'mark()', restored by 'rewind()'
 //-----------------------------------------------------------------------------
-template<typename T>
+struct BitsStreamMark
+{
+    size_t posBits;
+};
+
+//-----------------------------------------------------------------------------
+//- Bits serializer / deserializer base class for common operations, with the
+//- bounds check policy of the remaining bits.
+//-
+//- With the 'STATUS' bounds check policy, an out of bounds operation sets the
+//- (sticky) fail flag, and the following operations are ignored until the
+//- flag is cleared.
+//-----------------------------------------------------------------------------
+template<typename T, bounds_check Bounds = DefaultBoundsCheck>
 class BitsStream
 {
 public:
@@ -29,16 +44,28 @@ public:
 
     inline T & skip(size_t nbBits);
     inline T & reset(void);
+    inline T & align_to_byte(void);
+    inline T & seek(size_t bitPos);
+
+    inline BitsStreamMark mark(void) const noexcept;
+    inline T & rewind(const BitsStreamMark mark) noexcept;
 
     inline void setManipulation(const BitsStreamManipulation manip);
 
+    inline bool good(void) const noexcept;
+    inline bool fail(void) const noexcept;
+    inline void clear(void) noexcept;
+    inline explicit operator bool(void) const noexcept;
+
 protected:
-    inline void checkNbRemainingBits(size_t nbBits, std::string_view message);
+    inline bool checkBounds(bool inBounds, std::string_view message);
+    inline bool checkNbRemainingBits(size_t nbBits, std::string_view message);
 
-    const size_t lengthBits;
+    size_t lengthBits;
     const size_t offsetBits;
     size_t posBits;
     size_t nbBitsNext;
+    bool failed;
 };
 
 //-----------------------------------------------------------------------------
@@ -48,32 +75,31 @@ protected:
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-template<typename T>
-BitsStream<T>::BitsStream(size_t lengthBufferBits, size_t initialOffsetBits)
-: lengthBits(lengthBufferBits), offsetBits(initialOffsetBits), posBits(initialOffsetBits), nbBitsNext(0)
+template<typename T, bounds_check Bounds>
+BitsStream<T, Bounds>::BitsStream(size_t lengthBufferBits, size_t initialOffsetBits)
+: lengthBits(lengthBufferBits), offsetBits(initialOffsetBits), posBits(initialOffsetBits), nbBitsNext(0), failed(false)
 {}
 
 //-----------------------------------------------------------------------------
-template<typename T>
-size_t BitsStream<T>::nbBitsStreamed(void)
+template<typename T, bounds_check Bounds>
+size_t BitsStream<T, Bounds>::nbBitsStreamed(void)
 {
     return posBits - offsetBits;
 }
 
 //-----------------------------------------------------------------------------
-template<typename T>
-T & BitsStream<T>::skip(size_t nbBits)
+template<typename T, bounds_check Bounds>
+T & BitsStream<T, Bounds>::skip(size_t nbBits)
 {
-    checkNbRemainingBits(nbBits, "Unable to skip bits, too few bits remaining");
-
-    posBits += nbBits;
+    if(checkNbRemainingBits(nbBits, "Unable to skip bits, too few bits remaining"))
+        posBits += nbBits;
 
     return static_cast<T &>(*this);
 }
 
 //-----------------------------------------------------------------------------
-template<typename T>
-T & BitsStream<T>::reset(void)
+template<typename T, bounds_check Bounds>
+T & BitsStream<T, Bounds>::reset(void)
 {
     posBits = offsetBits;
     nbBitsNext = 0;
@@ -82,22 +108,119 @@ T & BitsStream<T>::reset(void)
 }
 
 //-----------------------------------------------------------------------------
-template<typename T>
-void BitsStream<T>::checkNbRemainingBits(size_t nbBits, std::string_view message)
+//- Bits streams buffers being whole bytes, the next byte boundary is always
+//- inside the buffer
+//-----------------------------------------------------------------------------
+template<typename T, bounds_check Bounds>
+T & BitsStream<T, Bounds>::align_to_byte(void)
+{
+    posBits = (posBits + CHAR_BIT - 1) / CHAR_BIT * CHAR_BIT;
+
+    return static_cast<T &>(*this);
+}
+
+//-----------------------------------------------------------------------------
+//- Move to a position relative to the stream start (as 'nbBitsStreamed()')
+//-----------------------------------------------------------------------------
+template<typename T, bounds_check Bounds>
+T & BitsStream<T, Bounds>::seek(size_t bitPos)
+{
+    if(checkBounds((offsetBits + bitPos) <= lengthBits, "Unable to seek, position outside of the buffer"))
+    {
+        posBits = offsetBits + bitPos;
+        nbBitsNext = 0;
+    }
+
+    return static_cast<T &>(*this);
+}
+
+//-----------------------------------------------------------------------------
+//- Speculative parsing : the position is saved by 'mark()' and restored by
+//- 'rewind()', the fail flag (if any) being left to 'clear()'
+//-----------------------------------------------------------------------------
+template<typename T, bounds_check Bounds>
+BitsStreamMark BitsStream<T, Bounds>::mark(void) const noexcept
+{
+    return { posBits };
+}
+
+//-----------------------------------------------------------------------------
+template<typename T, bounds_check Bounds>
+T & BitsStream<T, Bounds>::rewind(const BitsStreamMark mark) noexcept
+{
+    posBits = mark.posBits;
+    nbBitsNext = 0;
+
+    return static_cast<T &>(*this);
+}
+
+//-----------------------------------------------------------------------------
+template<typename T, bounds_check Bounds>
+bool BitsStream<T, Bounds>::good(void) const noexcept
+{
+    return not failed;
+}
+
+//-----------------------------------------------------------------------------
+template<typename T, bounds_check Bounds>
+bool BitsStream<T, Bounds>::fail(void) const noexcept
+{
+    return failed;
+}
+
+//-----------------------------------------------------------------------------
+template<typename T, bounds_check Bounds>
+void BitsStream<T, Bounds>::clear(void) noexcept
+{
+    failed = false;
+}
+
+//-----------------------------------------------------------------------------
+template<typename T, bounds_check Bounds>
+BitsStream<T, Bounds>::operator bool(void) const noexcept
+{
+    return not failed;
+}
+
+//-----------------------------------------------------------------------------
+//- Tell if the operation is to be done (the fail flag being only set and
+//- checked with the 'STATUS' bounds check policy)
+//-----------------------------------------------------------------------------
+template<typename T, bounds_check Bounds>
+bool BitsStream<T, Bounds>::checkBounds(bool inBounds, std::string_view message)
+{
+    if constexpr(Bounds::bounds_check == BoundsCheck::STATUS)
+    {
+        if(failed or not Bounds::check(inBounds, message))
+        {
+            failed = true;
+            nbBitsNext = 0;
+            return false;
+        }
+    }
+    else
+        Bounds::check(inBounds, message);
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+template<typename T, bounds_check Bounds>
+bool BitsStream<T, Bounds>::checkNbRemainingBits(size_t nbBits, std::string_view message)
 {
-    if((posBits + nbBits) > lengthBits)
-        throw std::out_of_range(message.data());
+    return checkBounds((posBits + nbBits) <= lengthBits, message);
 }
 
 //-----------------------------------------------------------------------------
-template<typename T>
-void BitsStream<T>::setManipulation(const BitsStreamManipulation manip)
+template<typename T, bounds_check Bounds>
+void BitsStream<T, Bounds>::setManipulation(const BitsStreamManipulation manip)
 {
     switch(manip.action)
     {
-        case BitsStreamManipulation::Action::STREAM_BITS : nbBitsNext = manip.value; break;
-        case BitsStreamManipulation::Action::SKIP_BITS   : posBits += manip.value; break;
-        case BitsStreamManipulation::Action::RESET       : posBits = offsetBits; break;
+        case BitsStreamManipulation::Action::STREAM_BITS   : nbBitsNext = manip.value; break;
+        case BitsStreamManipulation::Action::SKIP_BITS     : posBits += manip.value; break;
+        case BitsStreamManipulation::Action::RESET         : posBits = offsetBits; break;
+        case BitsStreamManipulation::Action::ALIGN_TO_BYTE : align_to_byte(); break;
     }
 }
 
@@ -19,6 +19,7 @@ struct BitsStreamManipulation
         STREAM_BITS,
         SKIP_BITS,
         RESET,
+        ALIGN_TO_BYTE,
     };
 
     Action action;
@@ -32,6 +33,7 @@ struct BitsStreamManipulation
 //-     - set the number of bits to insert / extract
 //-     - set the number of bits to skip
 //-     - reset stream to begining
+//-     - skip the bits up to the next byte boundary
 //-----------------------------------------------------------------------------
 inline detail::BitsStreamManipulation nbits(size_t nbBits)
 {
@@ -48,6 +50,11 @@ inline detail::BitsStreamManipulation reset(void)
     return { detail::BitsStreamManipulation::Action::RESET, 0 };
 }
 
+inline detail::BitsStreamManipulation align_to_byte(void)
+{
+    return { detail::BitsStreamManipulation::Action::ALIGN_TO_BYTE, 0 };
+}
+
 } // namespace bits
 
 #endif /* BITS_DETAIL_BITS_STREAM_MANIPULATION_H */
\ No newline at end of file
@@ -9,14 +9,18 @@
 
 #include <bits/detail/BaseSerialization.h>
 #include <bits/detail/underlying_integral_type.h>
+#include <bits/BitsOrder.h>
 #include <cstddef>
+#include <cassert>
 #include <span>
+#include <type_traits>
 
 namespace bits::detail {
 
 //-----------------------------------------------------------------------------
 //- Internal implementation of deserialization algorithm
 //-----------------------------------------------------------------------------
+template<bits_order Order = DefaultBitsOrder>
 class Deserializer : public BaseSerialization
 {
 public :
@@ -26,6 +30,11 @@ public :
 
 private:
     constexpr std::byte deserialize_first_byte_mask_8bits(size_t low, size_t high) const noexcept;
+    constexpr size_t    deserialize_word_shift(void) const noexcept;
+
+    constexpr bool      canExtractWord(const std::span<const std::byte> buffer) const noexcept;
+    constexpr word_t    extract_word(const std::span<const std::byte> buffer) const noexcept;
+    constexpr word_t    extract_lsb_first(const std::span<const std::byte> buffer) const noexcept;
 
     template<typename T> constexpr void extract_first_byte(T & val, const std::span<const std::byte> buffer) const noexcept;
     template<typename T> constexpr void extract_intermediate_bytes(T & val, const std::span<const std::byte> buffer) const noexcept;
@@ -35,6 +44,8 @@ private:
     const std::byte first_byte_mask;
     const size_t  last_byte_shift;
     const size_t  sign_shift;
+    const size_t  word_shift;
+    const word_t  word_mask;
 };
 
 
@@ -49,15 +60,19 @@ private:
 inline static constexpr size_t  last_byte_shift_8bits(size_t bit) { return     (bit % 8) + 1; }
 
 //-----------------------------------------------------------------------------
-constexpr Deserializer::Deserializer(size_t type_size, size_t high, size_t low) noexcept
+template<bits_order Order>
+constexpr Deserializer<Order>::Deserializer(size_t type_size, size_t high, size_t low) noexcept
 : BaseSerialization(high, low)
 , first_byte_mask  { deserialize_first_byte_mask_8bits(low, high) }
 , last_byte_shift  { last_byte_shift_8bits(high) }
 , sign_shift { type_size - high + low - 1 }
+, word_shift { deserialize_word_shift() }
+, word_mask  { mask_64bits(nb_bits) }
 {}
 
 //-----------------------------------------------------------------------------
-constexpr std::byte Deserializer::deserialize_first_byte_mask_8bits(size_t low, size_t high) const noexcept
+template<bits_order Order>
+constexpr std::byte Deserializer<Order>::deserialize_first_byte_mask_8bits(size_t low, size_t high) const noexcept
 {
     if(isSameByte())
         return mask_8bits(low, high);
@@ -66,14 +81,41 @@ constexpr std::byte Deserializer::deserialize_first_byte_mask_8bits(size_t low,
 }
 
 //-----------------------------------------------------------------------------
-template<typename T>
-constexpr void Deserializer::extract(const std::span<const std::byte> buffer, T & val) const noexcept
+template<bits_order Order>
+constexpr size_t Deserializer<Order>::deserialize_word_shift(void) const noexcept
 {
-    underlying_integral_type_t<T> rawVal = {};
+    if(isSingleWord())
+        return WORD_BITS - word_first_bit - nb_bits;
+    else
+        return WORD_BITS - nb_bits;
+}
 
-    extract_first_byte        (rawVal, buffer);
-    extract_intermediate_bytes(rawVal, buffer);
-    extract_last_byte         (rawVal, buffer);
+//-----------------------------------------------------------------------------
+template<bits_order Order>
+template<typename T>
+constexpr void Deserializer<Order>::extract(const std::span<const std::byte> buffer, T & val) const noexcept
+{
+    using RawType = underlying_integral_type_t<T>;
+    RawType rawVal = {};
+
+    if constexpr(Order::bit_order == BitOrder::LSB_FIRST)
+        rawVal = static_cast<RawType>(extract_lsb_first(buffer));
+    else if(canExtractWord(buffer))
+        rawVal = static_cast<RawType>(extract_word(buffer));
+    else if(isByteAligned())
+        rawVal = static_cast<RawType>(load_partial<std::endian::big>(buffer, byte_start, nb_bits / 8));
+    else
+    {
+        extract_first_byte        (rawVal, buffer);
+        extract_intermediate_bytes(rawVal, buffer);
+        extract_last_byte         (rawVal, buffer);
+    }
+
+    if constexpr(Order::swap_bytes)
+    {
+        assert((nb_bits % 8) == 0);
+        rawVal = static_cast<RawType>(swap_value_bytes(static_cast<std::make_unsigned_t<RawType>>(rawVal), nb_bits));
+    }
 
     if constexpr(std::is_signed_v<T>)
         rawVal = extend_sign(rawVal);
@@ -82,8 +124,54 @@ constexpr void Deserializer::extract(const std::span<const std::byte> buffer, T
 }
 
 //-----------------------------------------------------------------------------
+//- Word-at-a-time fast path : a whole 64 bits word is loaded from the first
+//- byte of the field, then the field is shifted and masked at once.
+//- Only fields crossing a 9th byte (more than 57 bits) need a second load.
+//- When the buffer tail is too short, byte aligned fields are loaded at once
+//- and other fields fall back to the byte-by-byte path.
+//-----------------------------------------------------------------------------
+template<bits_order Order>
+constexpr bool Deserializer<Order>::canExtractWord(const std::span<const std::byte> buffer) const noexcept
+{
+    return (byte_start + WORD_BYTES) <= buffer.size();
+}
+
+//-----------------------------------------------------------------------------
+template<bits_order Order>
+constexpr word_t Deserializer<Order>::extract_word(const std::span<const std::byte> buffer) const noexcept
+{
+    auto word = load<WORD_BYTES, std::endian::big>(buffer, byte_start);
+
+    if(isSingleWord())
+        return (word >> word_shift) & word_mask;
+
+    word = (word << word_first_bit) | std::to_integer<word_t>(buffer[byte_end] >> (8 - word_first_bit));
+    return word >> word_shift;
+}
+
+//-----------------------------------------------------------------------------
+//- LSB first numbering : the covering bytes are loaded as a little endian
+//- word, so that the field is shifted right by its offset in the first byte.
+//- The buffer tail is loaded byte by byte.
+//-----------------------------------------------------------------------------
+template<bits_order Order>
+constexpr word_t Deserializer<Order>::extract_lsb_first(const std::span<const std::byte> buffer) const noexcept
+{
+    auto word = canExtractWord(buffer)
+        ? load<WORD_BYTES, std::endian::little>(buffer, byte_start)
+        : load_partial<std::endian::little>(buffer, byte_start, buffer.size() - byte_start);
+
+    if(isSingleWord())
+        return (word >> word_first_bit) & word_mask;
+
+    word = (word >> word_first_bit) | (std::to_integer<word_t>(buffer[byte_end]) << (WORD_BITS - word_first_bit));
+    return word & word_mask;
+}
+
+//-----------------------------------------------------------------------------
+template<bits_order Order>
 template<typename T>
-constexpr void Deserializer::extract_first_byte(T & val, const std::span<const std::byte> buffer) const noexcept
+constexpr void Deserializer<Order>::extract_first_byte(T & val, const std::span<const std::byte> buffer) const noexcept
 {
     val = std::to_integer<T>(buffer[byte_start]);
     if(isSameByte())
@@ -92,24 +180,27 @@ constexpr void Deserializer::extract_first_byte(T & val, const std::span<const s
 }
 
 //-----------------------------------------------------------------------------
+template<bits_order Order>
 template<typename T>
-constexpr void Deserializer::extract_intermediate_bytes(T & val, const std::span<const std::byte> buffer) const noexcept
+constexpr void Deserializer<Order>::extract_intermediate_bytes(T & val, const std::span<const std::byte> buffer) const noexcept
 {
     for(size_t i=byte_start + 1; i<byte_end; i++)
         val = (val << 8) | std::to_integer<T>(buffer[i]);
 }
 
 //-----------------------------------------------------------------------------
+template<bits_order Order>
 template<typename T>
-constexpr void Deserializer::extract_last_byte(T & val, const std::span<const std::byte> buffer) const noexcept
+constexpr void Deserializer<Order>::extract_last_byte(T & val, const std::span<const std::byte> buffer) const noexcept
 {
     if(not isSameByte())
         val = (val << last_byte_shift) | (std::to_integer<T>(buffer[byte_end] >> (8 - last_byte_shift)));
 }
 
 //-----------------------------------------------------------------------------
+template<bits_order Order>
 template<typename T>
-constexpr T Deserializer::extend_sign(T val) const noexcept
+constexpr T Deserializer<Order>::extend_sign(T val) const noexcept
 {
     return static_cast<T>((val << sign_shift)) >> sign_shift;
 }
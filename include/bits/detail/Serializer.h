@@ -9,7 +9,9 @@
 
 #include <bits/detail/BaseSerialization.h>
 #include <bits/detail/underlying_integral_type.h>
+#include <bits/BitsOrder.h>
 #include <cstddef>
+#include <cassert>
 #include <span>
 
 namespace bits::detail {
@@ -17,6 +19,7 @@ namespace bits::detail {
 //-----------------------------------------------------------------------------
 //- Internal implementation of serialization algorithm
 //-----------------------------------------------------------------------------
+template<bits_order Order = DefaultBitsOrder>
 class Serializer : public BaseSerialization
 {
 public:
@@ -26,12 +29,21 @@ public:
 
 private:
     constexpr std::byte serialize_first_byte_mask_8bits(size_t low, size_t high) const noexcept;
+    constexpr size_t    serialize_word_shift(void) const noexcept;
+    constexpr word_t    serialize_word_mask(void) const noexcept;
+
+    constexpr bool canInsertWord(const std::span<std::byte> buffer) const noexcept;
+    constexpr void insert_word(word_t val, const std::span<std::byte> buffer) const noexcept;
+    constexpr void insert_lsb_first(word_t val, const std::span<std::byte> buffer) const noexcept;
 
     template<typename T> constexpr void insert_last_byte(T & val, const std::span<std::byte> buffer) const noexcept;
     template<typename T> constexpr void insert_intermediate_bytes(T & val, const std::span<std::byte> buffer) const noexcept;
     template<typename T> constexpr void insert_first_byte(T & val, const std::span<std::byte> buffer) const noexcept;
 
     const std::byte first_byte_mask;
+    const size_t    word_shift;
+    const word_t    word_mask;
+    const word_t    value_mask;
 };
 
 
@@ -47,24 +59,45 @@ inline static constexpr std::byte lower_mask_8bits(size_t bit) { return std::byt
 inline static constexpr std::byte upper_mask_8bits(size_t bit) { return ~mask_8bits(bit); }
 
 //-----------------------------------------------------------------------------
-constexpr Serializer::Serializer(size_t high, size_t low) noexcept
+template<bits_order Order>
+constexpr Serializer<Order>::Serializer(size_t high, size_t low) noexcept
 : BaseSerialization(high, low)
 , first_byte_mask { serialize_first_byte_mask_8bits(low, high) }
+, word_shift { serialize_word_shift() }
+, word_mask  { serialize_word_mask() }
+, value_mask { mask_64bits(nb_bits) }
 {}
 
 //-----------------------------------------------------------------------------
+template<bits_order Order>
 template<typename T>
-void constexpr Serializer::insert(T val, const std::span<std::byte> buffer) const noexcept
+void constexpr Serializer<Order>::insert(T val, const std::span<std::byte> buffer) const noexcept
 {
-    auto rawVal = static_cast<underlying_integral_type_t<T>>(val);
+    auto rawVal = static_cast<word_t>(static_cast<underlying_integral_type_t<T>>(val)) & value_mask;
+
+    if constexpr(Order::swap_bytes)
+    {
+        assert((nb_bits % 8) == 0);
+        rawVal = swap_value_bytes(rawVal, nb_bits);
+    }
 
-    insert_last_byte         (rawVal, buffer);
-    insert_intermediate_bytes(rawVal, buffer);
-    insert_first_byte        (rawVal, buffer);
+    if constexpr(Order::bit_order == BitOrder::LSB_FIRST)
+        insert_lsb_first(rawVal, buffer);
+    else if(canInsertWord(buffer))
+        insert_word(rawVal, buffer);
+    else if(isByteAligned())
+        store_partial<std::endian::big>(buffer, byte_start, nb_bits / 8, rawVal);
+    else
+    {
+        insert_last_byte         (rawVal, buffer);
+        insert_intermediate_bytes(rawVal, buffer);
+        insert_first_byte        (rawVal, buffer);
+    }
 }
 
 //-----------------------------------------------------------------------------
-constexpr std::byte Serializer::serialize_first_byte_mask_8bits(size_t low, size_t high) const noexcept
+template<bits_order Order>
+constexpr std::byte Serializer<Order>::serialize_first_byte_mask_8bits(size_t low, size_t high) const noexcept
 {
     if(isSameByte())
         return lower_mask_8bits(high) | upper_mask_8bits(low);
@@ -73,8 +106,88 @@ constexpr std::byte Serializer::serialize_first_byte_mask_8bits(size_t low, size
 }
 
 //-----------------------------------------------------------------------------
+template<bits_order Order>
+constexpr size_t Serializer<Order>::serialize_word_shift(void) const noexcept
+{
+    if(isSingleWord())
+        return WORD_BITS - word_first_bit - nb_bits;
+    else
+        return word_first_bit + nb_bits - WORD_BITS;
+}
+
+//-----------------------------------------------------------------------------
+template<bits_order Order>
+constexpr word_t Serializer<Order>::serialize_word_mask(void) const noexcept
+{
+    if(isSingleWord())
+        return mask_64bits(nb_bits) << word_shift;
+    else
+        return mask_64bits(WORD_BITS - word_first_bit);
+}
+
+//-----------------------------------------------------------------------------
+//- Word-at-a-time fast path : the 64 bits word covering the field is loaded
+//- once, the shifted value is merged in with a single precomputed mask and
+//- the word is stored back once. Fields crossing a 9th byte also merge their
+//- remaining low bits into that last byte.
+//- When the buffer tail is too short, byte aligned fields are stored at once
+//- and other fields fall back to the byte-by-byte path.
+//-----------------------------------------------------------------------------
+template<bits_order Order>
+constexpr bool Serializer<Order>::canInsertWord(const std::span<std::byte> buffer) const noexcept
+{
+    return (byte_start + WORD_BYTES) <= buffer.size();
+}
+
+//-----------------------------------------------------------------------------
+template<bits_order Order>
+constexpr void Serializer<Order>::insert_word(word_t val, const std::span<std::byte> buffer) const noexcept
+{
+    auto word = load<WORD_BYTES, std::endian::big>(buffer, byte_start);
+
+    if(isSingleWord())
+        word = (word & ~word_mask) | (val << word_shift);
+    else
+    {
+        word = (word & ~word_mask) | (val >> word_shift);
+        buffer[byte_end] = (buffer[byte_end] & std::byte((1 << first_byte_shift) - 1)) | std::byte(val << first_byte_shift);
+    }
+
+    store<WORD_BYTES, std::endian::big>(buffer, byte_start, word);
+}
+
+//-----------------------------------------------------------------------------
+//- LSB first numbering : the covering bytes are loaded as a little endian
+//- word, so that the value is shifted left by the field offset in the first
+//- byte. The buffer tail is loaded and stored byte by byte.
+//-----------------------------------------------------------------------------
+template<bits_order Order>
+constexpr void Serializer<Order>::insert_lsb_first(word_t val, const std::span<std::byte> buffer) const noexcept
+{
+    const auto mask = value_mask << word_first_bit;
+
+    if(not canInsertWord(buffer))
+    {
+        const auto nbBytes = buffer.size() - byte_start;
+        auto word = load_partial<std::endian::little>(buffer, byte_start, nbBytes);
+        store_partial<std::endian::little>(buffer, byte_start, nbBytes, (word & ~mask) | (val << word_first_bit));
+        return;
+    }
+
+    auto word = load<WORD_BYTES, std::endian::little>(buffer, byte_start);
+    store<WORD_BYTES, std::endian::little>(buffer, byte_start, (word & ~mask) | (val << word_first_bit));
+
+    if(not isSingleWord())
+    {
+        const auto last_byte_mask = std::byte((1 << (8 - first_byte_shift)) - 1);
+        buffer[byte_end] = (buffer[byte_end] & ~last_byte_mask) | std::byte(val >> (WORD_BITS - word_first_bit));
+    }
+}
+
+//-----------------------------------------------------------------------------
+template<bits_order Order>
 template<typename T>
-void constexpr Serializer::insert_last_byte(T & val, const std::span<std::byte> buffer) const noexcept
+void constexpr Serializer<Order>::insert_last_byte(T & val, const std::span<std::byte> buffer) const noexcept
 {
     if(not isSameByte())
     {
@@ -86,8 +199,9 @@ void constexpr Serializer::insert_last_byte(T & val, const std::span<std::byte>
 }
 
 //-----------------------------------------------------------------------------
+template<bits_order Order>
 template<typename T>
-void constexpr Serializer::insert_intermediate_bytes(T & val, const std::span<std::byte> buffer) const noexcept
+void constexpr Serializer<Order>::insert_intermediate_bytes(T & val, const std::span<std::byte> buffer) const noexcept
 {
     for(size_t i=byte_end ? byte_end - 1 : byte_start; i>byte_start; i--)
     {
@@ -97,8 +211,9 @@ void constexpr Serializer::insert_intermediate_bytes(T & val, const std::span<st
 }
 
 //-----------------------------------------------------------------------------
+template<bits_order Order>
 template<typename T>
-void constexpr Serializer::insert_first_byte(T & val, const std::span<std::byte> buffer) const noexcept
+void constexpr Serializer<Order>::insert_first_byte(T & val, const std::span<std::byte> buffer) const noexcept
 {
     if(isSameByte())
         val = (val << first_byte_shift) & std::to_integer<T>(~first_byte_mask);
@@ -0,0 +1,69 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_DETAIL_STATIC_BASE_SERIALIZATION_H
+#define BITS_DETAIL_STATIC_BASE_SERIALIZATION_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+
+#include <bits/detail/BaseSerialization.h>
+#include <bits/detail/word_access.h>
+#include <bits/BitsOrder.h>
+
+namespace bits::detail {
+
+//-----------------------------------------------------------------------------
+//- Kernels used by compile time bits range de/serialization
+//-----------------------------------------------------------------------------
+enum class StaticKernel
+{
+    SINGLE_BYTE,  // Field within one byte : one byte load, shift and mask
+    TWO_BYTES,    // Field within two bytes : one 16 bits load, shift and mask
+    BYTE_ALIGNED, // Field starting and ending on byte boundaries : one load, no shift nor mask
+    WORD,         // Field within 3 to 8 bytes : one load of the covering bytes, shift and mask
+    WIDE_WORD,    // Field crossing a 9th byte : one 64 bits load and one byte load
+};
+
+//-----------------------------------------------------------------------------
+//- Base class with compile time constants used by de/serialization kernels
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, bits_order Order = DefaultBitsOrder>
+struct StaticBaseSerialization
+{
+    static_assert(high >= low, "Bits range parameters order is 'high' first then 'low'");
+
+    static constexpr size_t byte_start     = num_byte(low);
+    static constexpr size_t byte_end       = num_byte(high);
+    static constexpr size_t nb_bytes       = byte_end - byte_start + 1;
+    static constexpr size_t nb_bits        = nb_bits_field(low, high);
+    static constexpr size_t word_first_bit = low % 8;
+
+    static constexpr StaticKernel kernel =
+        (nb_bytes == 1)                                  ? StaticKernel::SINGLE_BYTE  :
+        ((low % 8) == 0 and ((high + 1) % 8) == 0)       ? StaticKernel::BYTE_ALIGNED :
+        (nb_bytes == 2)                                  ? StaticKernel::TWO_BYTES    :
+        (nb_bytes <= WORD_BYTES)                         ? StaticKernel::WORD         :
+                                                           StaticKernel::WIDE_WORD;
+
+    // Bytes order of the loaded bytes
+    static constexpr std::endian load_order = Order::natural_byte_order;
+
+    // Shift of the field inside the loaded bytes (for MSB first WIDE_WORD kernel, number of bits in the 9th byte)
+    static constexpr size_t shift = (Order::bit_order == BitOrder::LSB_FIRST)
+        ? word_first_bit
+        : (kernel == StaticKernel::WIDE_WORD)
+        ? word_first_bit + nb_bits - WORD_BITS
+        : nb_bytes * CHAR_BIT - word_first_bit - nb_bits;
+    static constexpr word_t mask  = mask_64bits(nb_bits);
+
+    static_assert(not Order::swap_bytes or (nb_bits % 8) == 0, "Bits range should be a whole number of bytes when swapping bytes order");
+};
+
+} // namespace bits::detail
+
+#endif /* BITS_DETAIL_STATIC_BASE_SERIALIZATION_H */
@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_DETAIL_STATIC_DESERIALIZER_H
+#define BITS_DETAIL_STATIC_DESERIALIZER_H
+
+#include <bits/detail/StaticBaseSerialization.h>
+#include <bits/detail/underlying_integral_type.h>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace bits::detail {
+
+//-----------------------------------------------------------------------------
+//- Internal implementation of deserialization algorithm with compile time
+//- bits range. The kernel, shifts and masks are all template constants, so
+//- each field compiles to a fixed load / shift / mask sequence.
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, bits_order Order = DefaultBitsOrder>
+struct StaticDeserializer : public StaticBaseSerialization<high, low, Order>
+{
+    using Base = StaticBaseSerialization<high, low, Order>;
+
+    template<typename T> static constexpr void extract(const std::span<const std::byte> buffer, T & val) noexcept;
+
+    static constexpr word_t extract_raw(const std::span<const std::byte> buffer) noexcept;
+
+    template<typename T> static constexpr void from_raw(word_t rawVal, T & val) noexcept;
+};
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, bits_order Order>
+template<typename T>
+constexpr void StaticDeserializer<high, low, Order>::extract(const std::span<const std::byte> buffer, T & val) noexcept
+{
+    from_raw(extract_raw(buffer), val);
+}
+
+//-----------------------------------------------------------------------------
+//- Convert the raw bits of the field (right aligned) to the value : bytes
+//- order and sign extension
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, bits_order Order>
+template<typename T>
+constexpr void StaticDeserializer<high, low, Order>::from_raw(word_t rawVal, T & val) noexcept
+{
+    if constexpr(Order::swap_bytes)
+        rawVal = swap_value_bytes(rawVal, Base::nb_bits);
+
+    if constexpr(std::is_signed_v<T> and Base::nb_bits < WORD_BITS)
+        rawVal = static_cast<word_t>(static_cast<int64_t>(rawVal << (WORD_BITS - Base::nb_bits)) >> (WORD_BITS - Base::nb_bits));
+
+    val = static_cast<T>(static_cast<underlying_integral_type_t<T>>(rawVal));
+}
+
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, bits_order Order>
+constexpr word_t StaticDeserializer<high, low, Order>::extract_raw(const std::span<const std::byte> buffer) noexcept
+{
+    if constexpr(Base::kernel == StaticKernel::SINGLE_BYTE)
+        return (std::to_integer<word_t>(buffer[Base::byte_start]) >> Base::shift) & Base::mask;
+    else if constexpr(Base::kernel == StaticKernel::BYTE_ALIGNED)
+        return load<Base::nb_bytes, Base::load_order>(buffer, Base::byte_start);
+    else if constexpr(Base::kernel == StaticKernel::TWO_BYTES or Base::kernel == StaticKernel::WORD)
+        return (load<Base::nb_bytes, Base::load_order>(buffer, Base::byte_start) >> Base::shift) & Base::mask;
+    else if constexpr(Order::bit_order == BitOrder::LSB_FIRST)
+    {
+        auto word = load<WORD_BYTES, std::endian::little>(buffer, Base::byte_start) >> Base::word_first_bit;
+        auto last = std::to_integer<word_t>(buffer[Base::byte_end]) << (WORD_BITS - Base::word_first_bit);
+        return (word | last) & Base::mask;
+    }
+    else
+    {
+        auto word = load<WORD_BYTES, std::endian::big>(buffer, Base::byte_start) << Base::word_first_bit;
+        auto last = std::to_integer<word_t>(buffer[Base::byte_end]) >> (8 - Base::word_first_bit);
+        return (word | last) >> (WORD_BITS - Base::nb_bits);
+    }
+}
+
+} // namespace bits::detail
+
+#endif /* BITS_DETAIL_STATIC_DESERIALIZER_H */
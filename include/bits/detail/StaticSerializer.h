@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_DETAIL_STATIC_SERIALIZER_H
+#define BITS_DETAIL_STATIC_SERIALIZER_H
+
+#include <bits/detail/StaticBaseSerialization.h>
+#include <bits/detail/underlying_integral_type.h>
+#include <cstddef>
+#include <span>
+
+namespace bits::detail {
+
+//-----------------------------------------------------------------------------
+//- Internal implementation of serialization algorithm with compile time
+//- bits range. The kernel, shifts and masks are all template constants, so
+//- each field compiles to a fixed load / shift / mask / store sequence.
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, bits_order Order = DefaultBitsOrder>
+struct StaticSerializer : public StaticBaseSerialization<high, low, Order>
+{
+    using Base = StaticBaseSerialization<high, low, Order>;
+
+    template<typename T> static constexpr void insert(T val, const std::span<std::byte> buffer) noexcept;
+
+    static constexpr void insert_raw(word_t val, const std::span<std::byte> buffer) noexcept;
+};
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, bits_order Order>
+template<typename T>
+constexpr void StaticSerializer<high, low, Order>::insert(T val, const std::span<std::byte> buffer) noexcept
+{
+    auto rawVal = static_cast<word_t>(static_cast<underlying_integral_type_t<T>>(val)) & Base::mask;
+
+    if constexpr(Order::swap_bytes)
+        rawVal = swap_value_bytes(rawVal, Base::nb_bits);
+
+    insert_raw(rawVal, buffer);
+}
+
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, bits_order Order>
+constexpr void StaticSerializer<high, low, Order>::insert_raw(word_t val, const std::span<std::byte> buffer) noexcept
+{
+    if constexpr(Base::kernel == StaticKernel::SINGLE_BYTE)
+    {
+        constexpr auto mask = std::byte(Base::mask << Base::shift);
+        buffer[Base::byte_start] = (buffer[Base::byte_start] & ~mask) | std::byte(val << Base::shift);
+    }
+    else if constexpr(Base::kernel == StaticKernel::BYTE_ALIGNED)
+        store<Base::nb_bytes, Base::load_order>(buffer, Base::byte_start, val);
+    else if constexpr(Base::kernel == StaticKernel::TWO_BYTES or Base::kernel == StaticKernel::WORD)
+    {
+        constexpr auto mask = Base::mask << Base::shift;
+        auto word = load<Base::nb_bytes, Base::load_order>(buffer, Base::byte_start);
+        store<Base::nb_bytes, Base::load_order>(buffer, Base::byte_start, (word & ~mask) | (val << Base::shift));
+    }
+    else if constexpr(Order::bit_order == BitOrder::LSB_FIRST)
+    {
+        constexpr auto mask      = ~mask_64bits(Base::word_first_bit);
+        constexpr auto last_mask = std::byte((1 << (Base::word_first_bit + Base::nb_bits - WORD_BITS)) - 1);
+        auto word = load<WORD_BYTES, std::endian::little>(buffer, Base::byte_start);
+        store<WORD_BYTES, std::endian::little>(buffer, Base::byte_start, (word & ~mask) | (val << Base::word_first_bit));
+        buffer[Base::byte_end] = (buffer[Base::byte_end] & ~last_mask) | std::byte(val >> (WORD_BITS - Base::word_first_bit));
+    }
+    else
+    {
+        constexpr auto mask      = mask_64bits(WORD_BITS - Base::word_first_bit);
+        constexpr auto last_mask = std::byte((1 << (8 - Base::shift)) - 1);
+        auto word = load<WORD_BYTES, std::endian::big>(buffer, Base::byte_start);
+        store<WORD_BYTES, std::endian::big>(buffer, Base::byte_start, (word & ~mask) | (val >> Base::shift));
+        buffer[Base::byte_end] = (buffer[Base::byte_end] & last_mask) | std::byte(val << (8 - Base::shift));
+    }
+}
+
+} // namespace bits::detail
+
+#endif /* BITS_DETAIL_STATIC_SERIALIZER_H */
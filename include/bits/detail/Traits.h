@@ -29,6 +29,13 @@ struct IsFlagsBits : std::false_type {};
 template<typename T>
 struct IsFlagsBitsEnum : std::false_type {};
 
+//-----------------------------------------------------------------------------
+//- Trait to check if a type is an integer type wider than 64 bits
+//- (__int128 or bits::uint<N>, see detail/wide_integer.h and Uint.h)
+//-----------------------------------------------------------------------------
+template<typename T>
+struct IsWideInteger : std::false_type {};
+
 //-----------------------------------------------------------------------------
 //- Concept for output range and iterator with assigned value of the same type
 //- as dereferenced iterator
@@ -65,14 +72,20 @@ template<typename T, size_t N> struct is_std_span<std::span<T, N>> : std::true_t
 template<typename T> inline constexpr bool is_std_span_v = is_std_span<T>::value;
 
 //-----------------------------------------------------------------------------
-//- Concept to express a basic serializable type, that is an arithlmetic
-//- or enum type
+//- Concept to express a basic serializable type, that is an arithlmetic,
+//- enum or wide integer type
 //-----------------------------------------------------------------------------
 template <class T>
-concept input_basic_type = std::is_arithmetic_v<T> or std::is_enum_v<T> or IsFlagsBits<T>::value;
+concept input_basic_type = std::is_arithmetic_v<T> or std::is_enum_v<T> or IsFlagsBits<T>::value or IsWideInteger<T>::value;
 template<class T>
 concept output_basic_type = input_basic_type<T> and not std::is_const_v<T>;
 
+//-----------------------------------------------------------------------------
+//- Concept for a compile time bits range specification, such as BitsField
+//-----------------------------------------------------------------------------
+template<class T>
+concept bits_range_spec = requires { T::high; T::low; typename T::value_type; } and (T::high >= T::low);
+
 } // namespace bits::detail
 
 #endif // BITS_DETAIL_TRAITS_H
@@ -0,0 +1,289 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_DETAIL_BULK_PACK_H
+#define BITS_DETAIL_BULK_PACK_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <climits>
+#include <iterator>
+#include <span>
+#include <type_traits>
+
+#include <bits/BitsOrder.h>
+#include <bits/detail/BaseSerialization.h>
+#include <bits/detail/cpu_features.h>
+#include <bits/detail/word_access.h>
+
+#if BITS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace bits::detail {
+
+//-----------------------------------------------------------------------------
+//- Bulk packing of a contiguous array of integers into elements of the same
+//- number of bits, with default bits order (MSB first, big endian).
+//-
+//- Elements are appended to a 64 bits accumulator, which is stored as soon
+//- as it is full : each byte of the bits range is written exactly once, and
+//- only the first and last bytes are merged with the buffer content.
+//-
+//- Kernels :
+//-     - AVX2 : 8 elements by iteration (up to 32 bits)
+//-     - SSE4.2 : 4 elements by iteration (up to 32 bits)
+//-     - Scalar : one accumulator append by element (up to 64 bits)
+//-
+//- SIMD kernels mask the elements and concatenate adjacent ones inside the
+//- vector registers, so that the accumulator receives chunks of 2, 4 or 8
+//- elements instead of single elements.
+//-----------------------------------------------------------------------------
+inline constexpr size_t BULK_PACK_SIMD_MAX_BITS = 32;
+
+template<typename T>
+concept bulk_packable = std::is_integral_v<T> and not std::is_same_v<T, bool> and sizeof(T) <= sizeof(word_t);
+
+template<typename Order, typename I, typename S>
+concept bulk_packable_range = std::is_same_v<Order, MsbFirstBigEndian>
+                          and std::contiguous_iterator<I>
+                          and std::sized_sentinel_for<S, I>
+                          and bulk_packable<std::iter_value_t<I>>;
+
+//-----------------------------------------------------------------------------
+//- Bits accumulator writing a bits range from its first bit to its last bit
+//-----------------------------------------------------------------------------
+class BulkBitsWriter
+{
+public:
+    inline BulkBitsWriter(const std::span<std::byte> buffer, size_t low) noexcept;
+
+    inline void append(word_t val, size_t nbBits) noexcept;
+    inline void flush(void) noexcept;
+
+protected:
+    const std::span<std::byte> buffer;
+    size_t index;
+    word_t acc;
+    size_t accBits;
+};
+
+template<bulk_packable T>
+inline void bulk_pack(const std::span<std::byte> buffer, const T * in, size_t nbElements, size_t low, size_t nbBits) noexcept;
+
+template<bulk_packable T>
+inline void bulk_pack_scalar(const std::span<std::byte> buffer, const T * in, size_t nbElements, size_t low, size_t nbBits) noexcept;
+#if BITS_X86_SIMD
+template<bulk_packable T>
+BITS_TARGET("sse4.2") inline void bulk_pack_sse42(const std::span<std::byte> buffer, const T * in, size_t nbElements, size_t low, size_t nbBits) noexcept;
+template<bulk_packable T>
+BITS_TARGET("avx2")   inline void bulk_pack_avx2(const std::span<std::byte> buffer, const T * in, size_t nbElements, size_t low, size_t nbBits) noexcept;
+#endif
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//- The accumulator starts with the bits preceding the range in its first byte
+//-----------------------------------------------------------------------------
+BulkBitsWriter::BulkBitsWriter(const std::span<std::byte> buffer_, size_t low) noexcept
+: buffer(buffer_), index(num_byte(low)), acc(0), accBits(low % 8)
+{
+    if(accBits)
+        acc = std::to_integer<word_t>(buffer[index]) >> (8 - accBits);
+}
+
+//-----------------------------------------------------------------------------
+//- Append the 'nbBits' (1 to 64) right aligned bits of 'val' (upper bits
+//- should be zero)
+//-----------------------------------------------------------------------------
+void BulkBitsWriter::append(word_t val, size_t nbBits) noexcept
+{
+    const auto nbBitsTotal = accBits + nbBits;
+
+    if(nbBitsTotal < WORD_BITS)
+    {
+        acc = (acc << nbBits) | val;
+        accBits = nbBitsTotal;
+        return;
+    }
+
+    const auto nbBitsLeft = nbBitsTotal - WORD_BITS;
+    const auto word = (accBits ? (acc << (WORD_BITS - accBits)) : 0) | (val >> nbBitsLeft);
+    store<WORD_BYTES, std::endian::big>(buffer, index, word);
+    index += WORD_BYTES;
+
+    acc = val & mask_64bits(nbBitsLeft);
+    accBits = nbBitsLeft;
+}
+
+//-----------------------------------------------------------------------------
+//- Write remaining bytes, the last one being merged with the bits following
+//- the range
+//-----------------------------------------------------------------------------
+void BulkBitsWriter::flush(void) noexcept
+{
+    for(; accBits >= 8; accBits -= 8)
+        buffer[index++] = std::byte(acc >> (accBits - 8));
+
+    if(accBits)
+    {
+        const auto keepMask = std::byte((1 << (8 - accBits)) - 1);
+        buffer[index] = std::byte(acc << (8 - accBits)) | (buffer[index] & keepMask);
+        accBits = 0;
+    }
+}
+
+//-----------------------------------------------------------------------------
+template<bulk_packable T>
+inline void bulk_pack(const std::span<std::byte> buffer, const T * in, size_t nbElements, size_t low, size_t nbBits) noexcept
+{
+#if BITS_X86_SIMD
+    if(nbElements >= 8 and nbBits <= BULK_PACK_SIMD_MAX_BITS)
+    {
+        if(cpu_features().avx2)
+            return bulk_pack_avx2(buffer, in, nbElements, low, nbBits);
+        if(cpu_features().sse42)
+            return bulk_pack_sse42(buffer, in, nbElements, low, nbBits);
+    }
+#endif
+
+    bulk_pack_scalar(buffer, in, nbElements, low, nbBits);
+}
+
+//-----------------------------------------------------------------------------
+template<bulk_packable T>
+inline void bulk_pack_scalar(const std::span<std::byte> buffer, const T * in, size_t nbElements, size_t low, size_t nbBits) noexcept
+{
+    const auto mask = mask_64bits(nbBits);
+    BulkBitsWriter writer(buffer, low);
+
+    for(size_t i=0; i<nbElements; i++)
+        writer.append(static_cast<word_t>(static_cast<std::make_unsigned_t<T>>(in[i])) & mask, nbBits);
+
+    writer.flush();
+}
+
+#if BITS_X86_SIMD
+//-----------------------------------------------------------------------------
+//- Load 4 elements into 32 bits lanes (upper bits are masked afterward)
+//-----------------------------------------------------------------------------
+template<bulk_packable T>
+BITS_TARGET("sse4.2") inline __m128i bulk_load_lanes32(const T * in) noexcept
+{
+    if constexpr(sizeof(T) == 8)
+    {
+        const auto first  = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in)),     _MM_SHUFFLE(3, 1, 2, 0));
+        const auto second = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 2)), _MM_SHUFFLE(3, 1, 2, 0));
+        return _mm_unpacklo_epi64(first, second);
+    }
+    else if constexpr(sizeof(T) == 4)
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+    else if constexpr(sizeof(T) == 2)
+        return _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(in)));
+    else
+    {
+        int32_t packed;
+        std::memcpy(&packed, in, sizeof(packed));
+        return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed));
+    }
+}
+
+//-----------------------------------------------------------------------------
+template<bulk_packable T>
+BITS_TARGET("sse4.2") inline void bulk_pack_sse42(const std::span<std::byte> buffer, const T * in, size_t nbElements, size_t low, size_t nbBits) noexcept
+{
+    const auto mask       = _mm_set1_epi32(static_cast<int>(mask_64bits(nbBits)));
+    const auto lowDword   = _mm_set1_epi64x(0xFFFFFFFF);
+    const auto shiftCount = _mm_cvtsi32_si128(static_cast<int>(nbBits));
+    BulkBitsWriter writer(buffer, low);
+
+    size_t i = 0;
+    for(; (i + 4) <= nbElements; i += 4)
+    {
+        const auto v = _mm_and_si128(bulk_load_lanes32(in + i), mask);
+
+        // Concatenate elements pairs into 64 bits lanes
+        const auto pairs = _mm_or_si128(_mm_sll_epi64(_mm_and_si128(v, lowDword), shiftCount), _mm_srli_epi64(v, 32));
+
+        if(nbBits > 16)
+        {
+            writer.append(static_cast<word_t>(_mm_cvtsi128_si64(pairs)),                     2 * nbBits);
+            writer.append(static_cast<word_t>(_mm_cvtsi128_si64(_mm_srli_si128(pairs, 8))),  2 * nbBits);
+        }
+        else
+        {
+            const auto quad = (static_cast<word_t>(_mm_cvtsi128_si64(pairs)) << (2 * nbBits)) | static_cast<word_t>(_mm_cvtsi128_si64(_mm_srli_si128(pairs, 8)));
+            writer.append(quad, 4 * nbBits);
+        }
+    }
+
+    const auto elementMask = mask_64bits(nbBits);
+    for(; i<nbElements; i++)
+        writer.append(static_cast<word_t>(static_cast<std::make_unsigned_t<T>>(in[i])) & elementMask, nbBits);
+
+    writer.flush();
+}
+
+//-----------------------------------------------------------------------------
+template<bulk_packable T>
+BITS_TARGET("avx2") inline void bulk_pack_avx2(const std::span<std::byte> buffer, const T * in, size_t nbElements, size_t low, size_t nbBits) noexcept
+{
+    const auto mask       = _mm256_set1_epi32(static_cast<int>(mask_64bits(nbBits)));
+    const auto lowDword   = _mm256_set1_epi64x(0xFFFFFFFF);
+    const auto shiftCount = _mm_cvtsi32_si128(static_cast<int>(nbBits));
+    const auto pairsShift = _mm_cvtsi32_si128(static_cast<int>(2 * nbBits));
+    BulkBitsWriter writer(buffer, low);
+
+    size_t i = 0;
+    for(; (i + 8) <= nbElements; i += 8)
+    {
+        const auto v = _mm256_and_si256(_mm256_setr_m128i(bulk_load_lanes32(in + i), bulk_load_lanes32(in + i + 4)), mask);
+
+        // Concatenate elements pairs into 64 bits lanes, then pairs of pairs into the first 64 bits lane of each 128 bits lane
+        const auto pairs = _mm256_or_si256(_mm256_sll_epi64(_mm256_and_si256(v, lowDword), shiftCount), _mm256_srli_epi64(v, 32));
+        alignas(32) uint64_t chunks[4];
+
+        if(nbBits > 16)
+        {
+            _mm256_store_si256(reinterpret_cast<__m256i *>(chunks), pairs);
+            writer.append(chunks[0], 2 * nbBits);
+            writer.append(chunks[1], 2 * nbBits);
+            writer.append(chunks[2], 2 * nbBits);
+            writer.append(chunks[3], 2 * nbBits);
+        }
+        else
+        {
+            const auto quads = _mm256_or_si256(_mm256_sll_epi64(pairs, pairsShift), _mm256_srli_si256(pairs, 8));
+            _mm256_store_si256(reinterpret_cast<__m256i *>(chunks), quads);
+
+            if(nbBits > 8)
+            {
+                writer.append(chunks[0], 4 * nbBits);
+                writer.append(chunks[2], 4 * nbBits);
+            }
+            else
+                writer.append((chunks[0] << (4 * nbBits)) | chunks[2], 8 * nbBits);
+        }
+    }
+
+    const auto elementMask = mask_64bits(nbBits);
+    for(; i<nbElements; i++)
+        writer.append(static_cast<word_t>(static_cast<std::make_unsigned_t<T>>(in[i])) & elementMask, nbBits);
+
+    writer.flush();
+}
+#endif
+
+} // namespace bits::detail
+
+#endif /* BITS_DETAIL_BULK_PACK_H */
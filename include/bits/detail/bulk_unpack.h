@@ -0,0 +1,313 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_DETAIL_BULK_UNPACK_H
+#define BITS_DETAIL_BULK_UNPACK_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <climits>
+#include <array>
+#include <iterator>
+#include <span>
+#include <type_traits>
+
+#include <bits/BitsOrder.h>
+#include <bits/detail/BaseSerialization.h>
+#include <bits/detail/cpu_features.h>
+#include <bits/detail/word_access.h>
+
+#if BITS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace bits::detail {
+
+//-----------------------------------------------------------------------------
+//- Bulk unpacking of an array of elements packed with the same number of bits
+//- (1 to 32 bits) into a contiguous array of integers, with default bits
+//- order (MSB first, big endian).
+//-
+//- Kernels :
+//-     - AVX2 : 8 (up to 25 bits) or 4 (26 to 32 bits) elements by iteration
+//-     - SSE4.2 : 4 (up to 25 bits) or 2 (26 to 32 bits) elements by iteration
+//-     - Scalar : one unaligned 64 bits load by element
+//-
+//- The elements bits offsets in the first byte repeat every 8 elements, so
+//- the byte shuffle masks and the shifts of each lane are computed once by
+//- call. SIMD kernels finish the last elements (less than 16 bytes from the
+//- buffer end) with the scalar kernel.
+//-----------------------------------------------------------------------------
+inline constexpr size_t BULK_UNPACK_MAX_BITS = 32;
+
+template<typename T>
+concept bulk_unpackable = std::is_integral_v<T> and not std::is_same_v<T, bool> and sizeof(T) <= sizeof(word_t);
+
+template<typename Order, typename O, typename S>
+concept bulk_unpackable_range = std::is_same_v<Order, MsbFirstBigEndian>
+                            and std::contiguous_iterator<O>
+                            and std::sized_sentinel_for<S, O>
+                            and bulk_unpackable<std::iter_value_t<O>>
+                            and std::is_same_v<std::iter_reference_t<O>, std::iter_value_t<O> &>;
+
+template<bulk_unpackable T>
+inline void bulk_unpack(const std::span<const std::byte> buffer, T * out, size_t nbElements, size_t low, size_t nbBits) noexcept;
+
+template<bulk_unpackable T>
+inline void bulk_unpack_scalar(const std::span<const std::byte> buffer, T * out, size_t nbElements, size_t low, size_t nbBits) noexcept;
+#if BITS_X86_SIMD
+template<bulk_unpackable T>
+BITS_TARGET("sse4.2") inline void bulk_unpack_sse42(const std::span<const std::byte> buffer, T * out, size_t nbElements, size_t low, size_t nbBits) noexcept;
+template<bulk_unpackable T>
+BITS_TARGET("avx2")   inline void bulk_unpack_avx2(const std::span<const std::byte> buffer, T * out, size_t nbElements, size_t low, size_t nbBits) noexcept;
+#endif
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<bulk_unpackable T>
+inline void bulk_unpack(const std::span<const std::byte> buffer, T * out, size_t nbElements, size_t low, size_t nbBits) noexcept
+{
+#if BITS_X86_SIMD
+    if(nbElements >= 8)
+    {
+        if(cpu_features().avx2)
+            return bulk_unpack_avx2(buffer, out, nbElements, low, nbBits);
+        if(cpu_features().sse42)
+            return bulk_unpack_sse42(buffer, out, nbElements, low, nbBits);
+    }
+#endif
+
+    bulk_unpack_scalar(buffer, out, nbElements, low, nbBits);
+}
+
+//-----------------------------------------------------------------------------
+template<bulk_unpackable T>
+inline void bulk_unpack_scalar(const std::span<const std::byte> buffer, T * out, size_t nbElements, size_t low, size_t nbBits) noexcept
+{
+    const auto shift = WORD_BITS - nbBits;
+
+    for(size_t i=0; i<nbElements; i++, low += nbBits)
+    {
+        const auto byteStart = num_byte(low);
+        word_t word;
+
+        if(byteStart + WORD_BYTES <= buffer.size())
+            word = load<WORD_BYTES, std::endian::big>(buffer, byteStart);
+        else
+        {
+            const auto nbBytes = buffer.size() - byteStart;
+            word = load_partial<std::endian::big>(buffer, byteStart, nbBytes) << ((WORD_BYTES - nbBytes) * CHAR_BIT);
+        }
+
+        word <<= (low % 8);
+
+        if constexpr(std::is_signed_v<T>)
+            out[i] = static_cast<T>(static_cast<int64_t>(word) >> shift);
+        else
+            out[i] = static_cast<T>(word >> shift);
+    }
+}
+
+#if BITS_X86_SIMD
+//-----------------------------------------------------------------------------
+//- Byte shuffle mask and left shifts of 16 bytes holding several elements :
+//- each lane of 'laneBytes' bytes receives the big endian bytes of one element,
+//- the element's first bit being the lane's MSB after the left shift.
+//-----------------------------------------------------------------------------
+struct BulkLanes
+{
+    alignas(16) std::array<uint8_t, 16> shuffle;
+    std::array<uint8_t, 4> shifts;
+};
+
+inline BulkLanes bulk_lanes(size_t firstBit, size_t nbBits, size_t laneBytes) noexcept
+{
+    BulkLanes lanes = {};
+
+    for(size_t lane=0; lane<(16 / laneBytes); lane++)
+    {
+        const auto bit = firstBit + lane * nbBits;
+        for(size_t i=0; i<laneBytes; i++)
+            lanes.shuffle[lane * laneBytes + i] = static_cast<uint8_t>(num_byte(bit) + laneBytes - 1 - i);
+        lanes.shifts[lane] = static_cast<uint8_t>(bit % 8);
+    }
+
+    return lanes;
+}
+
+//-----------------------------------------------------------------------------
+//- Store 4 elements from 32 bits lanes (values already sign / zero extended)
+//-----------------------------------------------------------------------------
+template<bulk_unpackable T>
+BITS_TARGET("sse4.2") inline void bulk_store_lanes32(T * out, __m128i v) noexcept
+{
+    if constexpr(sizeof(T) == 8)
+    {
+        const auto high = _mm_srli_si128(v, 8);
+        if constexpr(std::is_signed_v<T>)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out),     _mm_cvtepi32_epi64(v));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2), _mm_cvtepi32_epi64(high));
+        }
+        else
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out),     _mm_cvtepu32_epi64(v));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2), _mm_cvtepu32_epi64(high));
+        }
+    }
+    else if constexpr(sizeof(T) == 4)
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), v);
+    else
+    {
+        v = std::is_signed_v<T> ? _mm_packs_epi32(v, v) : _mm_packus_epi32(v, v);
+        if constexpr(sizeof(T) == 2)
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(out), v);
+        else
+        {
+            v = std::is_signed_v<T> ? _mm_packs_epi16(v, v) : _mm_packus_epi16(v, v);
+            const auto packed = _mm_cvtsi128_si32(v);
+            std::memcpy(out, &packed, sizeof(packed));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+//- Store 2 elements from 64 bits lanes (more than 25 bits elements, so 'T' is
+//- at least 32 bits)
+//-----------------------------------------------------------------------------
+template<bulk_unpackable T>
+BITS_TARGET("sse4.2") inline void bulk_store_lanes64(T * out, __m128i v) noexcept
+{
+    if constexpr(sizeof(T) == 8)
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), v);
+    else if constexpr(sizeof(T) == 4)
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(out), _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+//-----------------------------------------------------------------------------
+template<bulk_unpackable T>
+BITS_TARGET("sse4.2") inline void bulk_unpack_sse42(const std::span<const std::byte> buffer, T * out, size_t nbElements, size_t low, size_t nbBits) noexcept
+{
+    const bool   lanes32     = (nbBits <= 25);
+    const size_t nbLanes     = lanes32 ? 4 : 2;
+    const size_t nbPhases    = 8 / nbLanes;
+    const auto   shiftCount  = _mm_cvtsi32_si128(static_cast<int>((lanes32 ? 32 : 64) - nbBits));
+    [[maybe_unused]] const auto signBit = _mm_set1_epi64x(static_cast<long long>(word_t(1) << (nbBits - 1)));
+
+    __m128i shuffles[4];
+    __m128i shifts[4];
+    std::array<size_t,  4> advances;
+    for(size_t phase=0; phase<nbPhases; phase++)
+    {
+        const auto firstBit = (low + phase * nbLanes * nbBits) % 8;
+        const auto lanes = bulk_lanes(firstBit, nbBits, lanes32 ? 4 : 8);
+        shuffles[phase] = _mm_load_si128(reinterpret_cast<const __m128i *>(lanes.shuffle.data()));
+        shifts[phase]   = lanes32 ? _mm_setr_epi32(1 << lanes.shifts[0], 1 << lanes.shifts[1], 1 << lanes.shifts[2], 1 << lanes.shifts[3])
+                                  : _mm_setr_epi32(lanes.shifts[0], 0, lanes.shifts[1], 0);
+        advances[phase] = num_byte(firstBit + nbLanes * nbBits);
+    }
+
+    size_t i = 0;
+    size_t byte = num_byte(low);
+    for(size_t phase=0; (i + nbLanes) <= nbElements and (byte + 16) <= buffer.size(); i += nbLanes, phase = (phase + 1) % nbPhases)
+    {
+        auto v = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer.data() + byte)), shuffles[phase]);
+
+        if(lanes32)
+        {
+            // Left shift of each lane by multiplication with its power of 2
+            v = _mm_mullo_epi32(v, shifts[phase]);
+            v = std::is_signed_v<T> ? _mm_sra_epi32(v, shiftCount) : _mm_srl_epi32(v, shiftCount);
+            bulk_store_lanes32(out + i, v);
+        }
+        else
+        {
+            v = _mm_blend_epi16(_mm_sll_epi64(v, shifts[phase]), _mm_sll_epi64(v, _mm_srli_si128(shifts[phase], 8)), 0xF0);
+            v = _mm_srl_epi64(v, shiftCount);
+            if constexpr(std::is_signed_v<T>)
+                v = _mm_sub_epi64(_mm_xor_si128(v, signBit), signBit);
+            bulk_store_lanes64(out + i, v);
+        }
+
+        byte += advances[phase];
+    }
+
+    bulk_unpack_scalar(buffer, out + i, nbElements - i, low + i * nbBits, nbBits);
+}
+
+//-----------------------------------------------------------------------------
+template<bulk_unpackable T>
+BITS_TARGET("avx2") inline void bulk_unpack_avx2(const std::span<const std::byte> buffer, T * out, size_t nbElements, size_t low, size_t nbBits) noexcept
+{
+    const bool   lanes32     = (nbBits <= 25);
+    const size_t nbLanes     = lanes32 ? 4 : 2;
+    const size_t nbPhases    = 4 / nbLanes;
+    const auto   shiftCount  = _mm_cvtsi32_si128(static_cast<int>((lanes32 ? 32 : 64) - nbBits));
+    [[maybe_unused]] const auto signBit = _mm256_set1_epi64x(static_cast<long long>(word_t(1) << (nbBits - 1)));
+
+    // Each 128 bits lane of the 256 bits register holds 'nbLanes' elements, loaded from its own address
+    __m256i shuffles[2];
+    __m256i shifts[2];
+    std::array<size_t,  2> highOffsets;
+    std::array<size_t,  2> advances;
+    for(size_t phase=0; phase<nbPhases; phase++)
+    {
+        const auto firstBit = (low + phase * 2 * nbLanes * nbBits) % 8;
+        const auto lowLanes  = bulk_lanes(firstBit, nbBits, lanes32 ? 4 : 8);
+        const auto highLanes = bulk_lanes((firstBit + nbLanes * nbBits) % 8, nbBits, lanes32 ? 4 : 8);
+
+        shuffles[phase] = _mm256_setr_m128i(_mm_load_si128(reinterpret_cast<const __m128i *>(lowLanes.shuffle.data())),
+                                            _mm_load_si128(reinterpret_cast<const __m128i *>(highLanes.shuffle.data())));
+        shifts[phase] = lanes32
+            ? _mm256_setr_epi32(lowLanes.shifts[0], lowLanes.shifts[1], lowLanes.shifts[2], lowLanes.shifts[3],
+                                highLanes.shifts[0], highLanes.shifts[1], highLanes.shifts[2], highLanes.shifts[3])
+            : _mm256_setr_epi64x(lowLanes.shifts[0], lowLanes.shifts[1], highLanes.shifts[0], highLanes.shifts[1]);
+        highOffsets[phase] = num_byte(firstBit + nbLanes * nbBits);
+        advances[phase]    = num_byte(firstBit + 2 * nbLanes * nbBits);
+    }
+
+    size_t i = 0;
+    size_t byte = num_byte(low);
+    for(size_t phase=0; (i + 2 * nbLanes) <= nbElements and (byte + highOffsets[phase] + 16) <= buffer.size(); i += 2 * nbLanes, phase = (phase + 1) % nbPhases)
+    {
+        auto v = _mm256_setr_m128i(_mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer.data() + byte)),
+                                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer.data() + byte + highOffsets[phase])));
+        v = _mm256_shuffle_epi8(v, shuffles[phase]);
+
+        if(lanes32)
+        {
+            v = _mm256_sllv_epi32(v, shifts[phase]);
+            v = std::is_signed_v<T> ? _mm256_sra_epi32(v, shiftCount) : _mm256_srl_epi32(v, shiftCount);
+            bulk_store_lanes32(out + i,     _mm256_castsi256_si128(v));
+            bulk_store_lanes32(out + i + 4, _mm256_extracti128_si256(v, 1));
+        }
+        else
+        {
+            v = _mm256_srl_epi64(_mm256_sllv_epi64(v, shifts[phase]), shiftCount);
+            if constexpr(std::is_signed_v<T>)
+                v = _mm256_sub_epi64(_mm256_xor_si256(v, signBit), signBit);
+            bulk_store_lanes64(out + i,     _mm256_castsi256_si128(v));
+            bulk_store_lanes64(out + i + 2, _mm256_extracti128_si256(v, 1));
+        }
+
+        byte += advances[phase];
+    }
+
+    bulk_unpack_scalar(buffer, out + i, nbElements - i, low + i * nbBits, nbBits);
+}
+#endif
+
+} // namespace bits::detail
+
+#endif /* BITS_DETAIL_BULK_UNPACK_H */
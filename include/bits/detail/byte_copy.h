@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_DETAIL_BYTE_COPY_H
+#define BITS_DETAIL_BYTE_COPY_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <bit>
+#include <iterator>
+#include <span>
+#include <type_traits>
+
+#include <bits/detail/underlying_integral_type.h>
+#include <bits/detail/word_access.h>
+
+namespace bits::detail {
+
+//-----------------------------------------------------------------------------
+//- Byte aligned fast path : a bits range starting on a byte boundary whose
+//- elements are whole bytes wide is a plain array of elements in the buffer,
+//- stored with the bytes order of the bits order policy (whatever the bits
+//- numbering).
+//-
+//- One byte elements, and elements in native bytes order, are copied with
+//- memmove. Other elements are loaded / stored one by one with a byte swap.
+//-----------------------------------------------------------------------------
+template<typename T>
+concept byte_copyable = (std::is_integral_v<T> or std::is_enum_v<T>) and not std::is_same_v<T, bool> and sizeof(T) <= sizeof(word_t);
+
+template<typename I, typename S>
+concept byte_copyable_range = std::contiguous_iterator<I>
+                          and std::sized_sentinel_for<S, I>
+                          and byte_copyable<std::iter_value_t<I>>;
+
+template<byte_copyable T>
+inline constexpr bool is_byte_copy(size_t low, size_t nbBitsByElement) noexcept;
+
+template<std::endian byteOrder, byte_copyable T>
+inline constexpr void byte_copy_extract(const std::span<const std::byte> buffer, T * out, size_t nbElements, size_t low) noexcept;
+template<std::endian byteOrder, byte_copyable T>
+inline constexpr void byte_copy_insert(const std::span<std::byte> buffer, const T * in, size_t nbElements, size_t low) noexcept;
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<byte_copyable T>
+inline constexpr bool is_byte_copy(size_t low, size_t nbBitsByElement) noexcept
+{
+    return (low % 8) == 0 and nbBitsByElement == (sizeof(T) * 8);
+}
+
+//-----------------------------------------------------------------------------
+template<std::endian byteOrder, byte_copyable T>
+inline constexpr void byte_copy_extract(const std::span<const std::byte> buffer, T * out, size_t nbElements, size_t low) noexcept
+{
+    const auto index = low / 8;
+
+    if(not std::is_constant_evaluated() and (sizeof(T) == 1 or byteOrder == std::endian::native))
+    {
+        std::memmove(out, buffer.data() + index, nbElements * sizeof(T));
+        return;
+    }
+
+    for(size_t i=0; i<nbElements; i++)
+        out[i] = static_cast<T>(static_cast<underlying_integral_type_t<T>>(load<sizeof(T), byteOrder>(buffer, index + i * sizeof(T))));
+}
+
+//-----------------------------------------------------------------------------
+template<std::endian byteOrder, byte_copyable T>
+inline constexpr void byte_copy_insert(const std::span<std::byte> buffer, const T * in, size_t nbElements, size_t low) noexcept
+{
+    const auto index = low / 8;
+
+    if(not std::is_constant_evaluated() and (sizeof(T) == 1 or byteOrder == std::endian::native))
+    {
+        std::memmove(buffer.data() + index, in, nbElements * sizeof(T));
+        return;
+    }
+
+    for(size_t i=0; i<nbElements; i++)
+        store<sizeof(T), byteOrder>(buffer, index + i * sizeof(T), static_cast<word_t>(static_cast<underlying_integral_type_t<T>>(in[i])));
+}
+
+} // namespace bits::detail
+
+#endif /* BITS_DETAIL_BYTE_COPY_H */
@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_DETAIL_CPU_FEATURES_H
+#define BITS_DETAIL_CPU_FEATURES_H
+
+//-----------------------------------------------------------------------------
+//- x86-64 SIMD kernels are compiled with per function target attributes, so
+//- that the library doesn't require any '-m' compiler flag. They are selected
+//- at runtime depending on the features of the CPU.
+//-----------------------------------------------------------------------------
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define BITS_X86_SIMD 1
+#define BITS_TARGET(features) __attribute__((target(features)))
+#else
+#define BITS_X86_SIMD 0
+#endif
+
+namespace bits::detail {
+
+//-----------------------------------------------------------------------------
+//- CPU features used by the SIMD kernels
+//-----------------------------------------------------------------------------
+struct CpuFeatures
+{
+    bool sse42 = false;
+    bool avx2  = false;
+    bool bmi2  = false; // Fast PEXT / PDEP (microcoded on AMD Zen 1 / Zen 2, so disabled there)
+};
+
+inline const CpuFeatures & cpu_features(void) noexcept;
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+inline const CpuFeatures & cpu_features(void) noexcept
+{
+    static const CpuFeatures features = [] {
+        CpuFeatures detected;
+#if BITS_X86_SIMD
+        __builtin_cpu_init();
+        detected.sse42 = __builtin_cpu_supports("sse4.2");
+        detected.avx2  = __builtin_cpu_supports("avx2");
+        detected.bmi2  = __builtin_cpu_supports("bmi2") and not __builtin_cpu_is("znver1") and not __builtin_cpu_is("znver2");
+#endif
+        return detected;
+    }();
+
+    return features;
+}
+
+} // namespace bits::detail
+
+#endif /* BITS_DETAIL_CPU_FEATURES_H */
@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_DETAIL_FIELDS_GROUPS_H
+#define BITS_DETAIL_FIELDS_GROUPS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <climits>
+#include <array>
+#include <algorithm>
+
+#include <bits/detail/word_access.h>
+
+namespace bits::detail {
+
+//-----------------------------------------------------------------------------
+//- Compile time bits range of a field extracted with other fields
+//- (see 'extract_fields()')
+//-----------------------------------------------------------------------------
+struct grouped_field
+{
+    size_t high;
+    size_t low;
+    size_t nb_bits_by_element; // Ranges only
+    bool   groupable;          // Extracted from the word of its group, or with its own kernel
+};
+
+inline constexpr size_t NO_GROUP = SIZE_MAX;
+
+//-----------------------------------------------------------------------------
+//- Groups of fields covered by a same word : the bytes loaded once for all
+//- the fields of the group
+//-----------------------------------------------------------------------------
+template<size_t N>
+struct fields_groups
+{
+    std::array<size_t, N> group_of_field = {};
+    std::array<size_t, N> byte_start     = {};
+    std::array<size_t, N> nb_bytes       = {};
+    size_t                nb_groups      = 0;
+};
+
+template<size_t N>
+inline constexpr fields_groups<N> group_fields(const std::array<grouped_field, N> & fields) noexcept;
+
+template<auto fields>
+inline constexpr auto fields_groups_v = group_fields(fields);
+
+
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//- Fields are grouped greedily, in their order : a field joins the last
+//- group as long as the bytes covered by the group still fit into a word,
+//- and starts a new group otherwise
+//-----------------------------------------------------------------------------
+template<size_t N>
+inline constexpr fields_groups<N> group_fields(const std::array<grouped_field, N> & fields) noexcept
+{
+    fields_groups<N> groups;
+    size_t lastGroup = NO_GROUP;
+
+    for(size_t i=0; i<N; i++)
+    {
+        const size_t byteStart = fields[i].low / CHAR_BIT;
+        const size_t byteEnd   = fields[i].high / CHAR_BIT;
+
+        if(not fields[i].groupable or (byteEnd - byteStart + 1) > WORD_BYTES)
+        {
+            groups.group_of_field[i] = NO_GROUP;
+            continue;
+        }
+
+        if(lastGroup != NO_GROUP)
+        {
+            const size_t groupStart = std::min(groups.byte_start[lastGroup], byteStart);
+            const size_t groupEnd   = std::max(groups.byte_start[lastGroup] + groups.nb_bytes[lastGroup] - 1, byteEnd);
+
+            if((groupEnd - groupStart + 1) <= WORD_BYTES)
+            {
+                groups.byte_start[lastGroup] = groupStart;
+                groups.nb_bytes[lastGroup]   = groupEnd - groupStart + 1;
+                groups.group_of_field[i]     = lastGroup;
+                continue;
+            }
+        }
+
+        lastGroup = groups.nb_groups++;
+        groups.byte_start[lastGroup] = byteStart;
+        groups.nb_bytes[lastGroup]   = byteEnd - byteStart + 1;
+        groups.group_of_field[i]     = lastGroup;
+    }
+
+    return groups;
+}
+
+} // namespace bits::detail
+
+#endif /* BITS_DETAIL_FIELDS_GROUPS_H */
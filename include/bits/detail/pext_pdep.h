@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_DETAIL_PEXT_PDEP_H
+#define BITS_DETAIL_PEXT_PDEP_H
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <bit>
+#include <utility>
+#include <type_traits>
+
+#include <bits/detail/cpu_features.h>
+#include <bits/detail/word_access.h>
+
+#if BITS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace bits::detail {
+
+//-----------------------------------------------------------------------------
+//- Gather (pext) / scatter (pdep) of the bits of a compile time mask :
+//-     - pext : bits of 'val' selected by 'mask' are packed into the low bits
+//-     - pdep : low bits of 'val' are deposited into the bits set in 'mask'
+//-
+//- Kernels :
+//-     - Contiguous mask : single shift and mask
+//-     - BMI2 : single PEXT / PDEP instruction, used directly when compiled
+//-       with BMI2 enabled (-mbmi2, -march=haswell...), else selected at
+//-       runtime on CPUs with fast PEXT / PDEP
+//-     - Portable : one shift and mask by run of contiguous bits of the mask,
+//-       all constant folded
+//-----------------------------------------------------------------------------
+template<uint64_t mask> inline constexpr word_t pext(word_t val) noexcept;
+template<uint64_t mask> inline constexpr word_t pdep(word_t val) noexcept;
+
+template<uint64_t mask> inline constexpr word_t pext_portable(word_t val) noexcept;
+template<uint64_t mask> inline constexpr word_t pdep_portable(word_t val) noexcept;
+#if BITS_X86_SIMD
+BITS_TARGET("bmi2") inline word_t pext_bmi2(word_t val, word_t mask) noexcept;
+BITS_TARGET("bmi2") inline word_t pdep_bmi2(word_t val, word_t mask) noexcept;
+#endif
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//- Runs of contiguous bits of a mask : position in the mask, length and
+//- position in the packed value
+//-----------------------------------------------------------------------------
+struct MaskRun
+{
+    size_t pos;
+    size_t length;
+    size_t packedPos;
+};
+
+template<uint64_t mask>
+inline constexpr size_t nb_mask_runs = std::popcount(mask & ~(mask << 1));
+
+template<uint64_t mask>
+inline constexpr std::array<MaskRun, nb_mask_runs<mask>> mask_runs = [] {
+    std::array<MaskRun, nb_mask_runs<mask>> runs = {};
+    auto remaining = mask;
+    size_t packedPos = 0;
+
+    for(auto & run : runs)
+    {
+        run.pos    = static_cast<size_t>(std::countr_zero(remaining));
+        run.length = static_cast<size_t>(std::countr_one(remaining >> run.pos));
+        run.packedPos = packedPos;
+
+        packedPos += run.length;
+        remaining &= ~(mask_64bits(run.length) << run.pos);
+    }
+
+    return runs;
+}();
+
+//-----------------------------------------------------------------------------
+template<uint64_t mask>
+inline constexpr word_t pext_portable(word_t val) noexcept
+{
+    return [val]<size_t... I>(std::index_sequence<I...>) {
+        return (word_t(0) | ... | (((val >> mask_runs<mask>[I].pos) & mask_64bits(mask_runs<mask>[I].length)) << mask_runs<mask>[I].packedPos));
+    }(std::make_index_sequence<nb_mask_runs<mask>>());
+}
+
+//-----------------------------------------------------------------------------
+template<uint64_t mask>
+inline constexpr word_t pdep_portable(word_t val) noexcept
+{
+    return [val]<size_t... I>(std::index_sequence<I...>) {
+        return (word_t(0) | ... | (((val >> mask_runs<mask>[I].packedPos) & mask_64bits(mask_runs<mask>[I].length)) << mask_runs<mask>[I].pos));
+    }(std::make_index_sequence<nb_mask_runs<mask>>());
+}
+
+#if BITS_X86_SIMD
+//-----------------------------------------------------------------------------
+BITS_TARGET("bmi2") inline word_t pext_bmi2(word_t val, word_t mask) noexcept
+{
+    return _pext_u64(val, mask);
+}
+
+//-----------------------------------------------------------------------------
+BITS_TARGET("bmi2") inline word_t pdep_bmi2(word_t val, word_t mask) noexcept
+{
+    return _pdep_u64(val, mask);
+}
+#endif
+
+//-----------------------------------------------------------------------------
+template<uint64_t mask>
+inline constexpr word_t pext(word_t val) noexcept
+{
+    static_assert(mask != 0, "Mask should have at least one bit set");
+
+    if constexpr(nb_mask_runs<mask> <= 1)
+        return (val >> std::countr_zero(mask)) & (mask >> std::countr_zero(mask));
+    else
+    {
+        if(std::is_constant_evaluated())
+            return pext_portable<mask>(val);
+
+#if defined(__BMI2__)
+        return _pext_u64(val, mask);
+#elif BITS_X86_SIMD
+        if(cpu_features().bmi2)
+            return pext_bmi2(val, mask);
+        return pext_portable<mask>(val);
+#else
+        return pext_portable<mask>(val);
+#endif
+    }
+}
+
+//-----------------------------------------------------------------------------
+template<uint64_t mask>
+inline constexpr word_t pdep(word_t val) noexcept
+{
+    static_assert(mask != 0, "Mask should have at least one bit set");
+
+    if constexpr(nb_mask_runs<mask> <= 1)
+        return (val << std::countr_zero(mask)) & mask;
+    else
+    {
+        if(std::is_constant_evaluated())
+            return pdep_portable<mask>(val);
+
+#if defined(__BMI2__)
+        return _pdep_u64(val, mask);
+#elif BITS_X86_SIMD
+        if(cpu_features().bmi2)
+            return pdep_bmi2(val, mask);
+        return pdep_portable<mask>(val);
+#else
+        return pdep_portable<mask>(val);
+#endif
+    }
+}
+
+} // namespace bits::detail
+
+#endif /* BITS_DETAIL_PEXT_PDEP_H */
@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_DETAIL_RING_BUFFER_H
+#define BITS_DETAIL_RING_BUFFER_H
+
+#include <cstddef>
+#include <cstring>
+#include <climits>
+#include <span>
+
+namespace bits::detail {
+
+//-----------------------------------------------------------------------------
+//- Ring (circular) buffer helpers : bits positions are relative to the ring
+//- head, and wrap past the ring end to its beginning.
+//-
+//- Fields not wrapping are accessed in place. Fields wrapping are gathered
+//- into (and scattered back from) a small linear buffer, a copy in at most
+//- two parts.
+//-----------------------------------------------------------------------------
+inline constexpr size_t ring_position(size_t capacityBits, size_t headBits, size_t posBits) noexcept;
+inline constexpr bool   ring_wraps(size_t capacityBits, size_t ringPosBits, size_t nbBits) noexcept;
+
+inline void ring_gather(const std::span<const std::byte> ring, size_t index, const std::span<std::byte> out) noexcept;
+inline void ring_scatter(const std::span<std::byte> ring, size_t index, const std::span<const std::byte> in) noexcept;
+
+
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+inline constexpr size_t ring_position(size_t capacityBits, size_t headBits, size_t posBits) noexcept
+{
+    const auto ringPosBits = headBits + posBits;
+
+    return ringPosBits < capacityBits ? ringPosBits : ringPosBits - capacityBits;
+}
+
+//-----------------------------------------------------------------------------
+inline constexpr bool ring_wraps(size_t capacityBits, size_t ringPosBits, size_t nbBits) noexcept
+{
+    return (ringPosBits + nbBits) > capacityBits;
+}
+
+//-----------------------------------------------------------------------------
+inline void ring_gather(const std::span<const std::byte> ring, size_t index, const std::span<std::byte> out) noexcept
+{
+    const auto nbFirstBytes = (out.size() < (ring.size() - index)) ? out.size() : (ring.size() - index);
+
+    std::memcpy(out.data(), ring.data() + index, nbFirstBytes);
+    std::memcpy(out.data() + nbFirstBytes, ring.data(), out.size() - nbFirstBytes);
+}
+
+//-----------------------------------------------------------------------------
+inline void ring_scatter(const std::span<std::byte> ring, size_t index, const std::span<const std::byte> in) noexcept
+{
+    const auto nbFirstBytes = (in.size() < (ring.size() - index)) ? in.size() : (ring.size() - index);
+
+    std::memcpy(ring.data() + index, in.data(), nbFirstBytes);
+    std::memcpy(ring.data(), in.data() + nbFirstBytes, in.size() - nbFirstBytes);
+}
+
+} // namespace bits::detail
+
+#endif /* BITS_DETAIL_RING_BUFFER_H */
@@ -0,0 +1,246 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_DETAIL_WIDE_INTEGER_H
+#define BITS_DETAIL_WIDE_INTEGER_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cassert>
+#include <array>
+#include <span>
+#include <utility>
+#include <type_traits>
+
+#include <bits/BitsOrder.h>
+#include <bits/detail/Traits.h>
+#include <bits/detail/Serializer.h>
+#include <bits/detail/Deserializer.h>
+#include <bits/detail/StaticSerializer.h>
+#include <bits/detail/StaticDeserializer.h>
+#include <bits/detail/word_access.h>
+
+namespace bits::detail {
+
+//-----------------------------------------------------------------------------
+//- 128 bits integers, when supported by the compiler
+//-----------------------------------------------------------------------------
+#if defined(__SIZEOF_INT128__)
+#define BITS_HAS_INT128 1
+__extension__ typedef __int128          int128_t;
+__extension__ typedef unsigned __int128 uint128_t;
+#else
+#define BITS_HAS_INT128 0
+#endif
+
+//-----------------------------------------------------------------------------
+//- Conversion of integers wider than 64 bits from / to an array of words
+//- (least significant word first). Specialized for each wide integer type,
+//- which is then also flagged by the IsWideInteger trait.
+//-----------------------------------------------------------------------------
+template<typename T>
+struct WideInteger;
+
+template<typename T>
+using wide_words_t = std::array<word_t, WideInteger<T>::nb_words>;
+
+#if BITS_HAS_INT128
+template<> struct IsWideInteger<int128_t>  : std::true_type {};
+template<> struct IsWideInteger<uint128_t> : std::true_type {};
+
+template<typename T>
+requires(std::is_same_v<T, int128_t> or std::is_same_v<T, uint128_t>)
+struct WideInteger<T>
+{
+    static constexpr size_t nb_words  = 2;
+    static constexpr bool   is_signed = std::is_same_v<T, int128_t>;
+
+    static constexpr std::array<word_t, 2> to_words(T val) noexcept { return { static_cast<word_t>(val), static_cast<word_t>(static_cast<uint128_t>(val) >> 64) }; }
+    static constexpr T from_words(const std::array<word_t, 2> & words) noexcept { return static_cast<T>((static_cast<uint128_t>(words[1]) << 64) | words[0]); }
+};
+#endif
+
+//-----------------------------------------------------------------------------
+//- Wide fields are split into 64 bits chunks, each one being de/serialized
+//- with the word kernels (so with one or two word loads each) using the
+//- natural bytes order of the bits numbering. The bytes of the whole value
+//- are then swapped, if needed.
+//-----------------------------------------------------------------------------
+template<bits_order Order, typename T>
+constexpr void wide_extract(const std::span<const std::byte> buffer, T & val, size_t high, size_t low) noexcept;
+template<bits_order Order, typename T>
+constexpr void wide_insert(const std::span<std::byte> buffer, T val, size_t high, size_t low) noexcept;
+
+template<size_t high, size_t low, bits_order Order, typename T>
+constexpr void wide_extract(const std::span<const std::byte> buffer, T & val) noexcept;
+template<size_t high, size_t low, bits_order Order, typename T>
+constexpr void wide_insert(const std::span<std::byte> buffer, T val) noexcept;
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//- Bits order with the natural bytes order of the bits numbering
+//-----------------------------------------------------------------------------
+template<bits_order Order>
+using natural_bits_order_t = BitsOrder<Order::bit_order, Order::natural_byte_order>;
+
+//-----------------------------------------------------------------------------
+//- Bits range of the 'k'th word of a wide field (value bits [64k, 64k+63])
+//-----------------------------------------------------------------------------
+inline constexpr size_t wide_chunk_nb_bits(size_t nbBits, size_t k) noexcept
+{
+    return (nbBits - k * WORD_BITS) < WORD_BITS ? (nbBits - k * WORD_BITS) : WORD_BITS;
+}
+
+template<bits_order Order>
+inline constexpr size_t wide_chunk_low(size_t high, size_t low, size_t k) noexcept
+{
+    if constexpr(Order::bit_order == BitOrder::LSB_FIRST)
+        return low + k * WORD_BITS;
+    else
+        return high - k * WORD_BITS - wide_chunk_nb_bits(high - low + 1, k) + 1;
+}
+
+template<bits_order Order>
+inline constexpr size_t wide_chunk_high(size_t high, size_t low, size_t k) noexcept
+{
+    return wide_chunk_low<Order>(high, low, k) + wide_chunk_nb_bits(high - low + 1, k) - 1;
+}
+
+//-----------------------------------------------------------------------------
+//- Reverse the bytes order of a right aligned value of 'nbBits' bits
+//- (should be a whole number of bytes)
+//-----------------------------------------------------------------------------
+template<size_t N>
+inline constexpr void swap_wide_bytes(std::array<word_t, N> & words, size_t nbBits) noexcept
+{
+    std::array<word_t, N> swapped = {};
+    const auto nbBytes = nbBits / 8;
+
+    for(size_t i=0; i<nbBytes; i++)
+    {
+        const auto j = nbBytes - i - 1;
+        swapped[j / WORD_BYTES] |= ((words[i / WORD_BYTES] >> ((i % WORD_BYTES) * 8)) & 0xFF) << ((j % WORD_BYTES) * 8);
+    }
+
+    words = swapped;
+}
+
+//-----------------------------------------------------------------------------
+//- Fix words after extraction : bytes order and sign extension
+//-----------------------------------------------------------------------------
+template<bits_order Order, typename T>
+inline constexpr T wide_from_words(wide_words_t<T> words, size_t nbBits) noexcept
+{
+    if constexpr(Order::swap_bytes)
+    {
+        assert((nbBits % 8) == 0);
+        swap_wide_bytes(words, nbBits);
+    }
+
+    if constexpr(WideInteger<T>::is_signed)
+    {
+        const auto signWord = (nbBits - 1) / WORD_BITS;
+        const auto signBits = nbBits - signWord * WORD_BITS;
+        if((words[signWord] >> (signBits - 1)) & 1)
+        {
+            words[signWord] |= ~mask_64bits(signBits);
+            for(size_t k=signWord + 1; k<words.size(); k++)
+                words[k] = ~word_t(0);
+        }
+    }
+
+    return WideInteger<T>::from_words(words);
+}
+
+//-----------------------------------------------------------------------------
+//- Get words before insertion : bytes order
+//-----------------------------------------------------------------------------
+template<bits_order Order, typename T>
+inline constexpr wide_words_t<T> wide_to_words(T val, [[maybe_unused]] size_t nbBits) noexcept
+{
+    auto words = WideInteger<T>::to_words(val);
+
+    if constexpr(Order::swap_bytes)
+    {
+        assert((nbBits % 8) == 0);
+        swap_wide_bytes(words, nbBits);
+    }
+
+    return words;
+}
+
+//-----------------------------------------------------------------------------
+template<bits_order Order, typename T>
+constexpr void wide_extract(const std::span<const std::byte> buffer, T & val, size_t high, size_t low) noexcept
+{
+    using ChunkOrder = natural_bits_order_t<Order>;
+    const auto nbBits = high - low + 1;
+    wide_words_t<T> words = {};
+
+    for(size_t k=0; (k * WORD_BITS) < nbBits; k++)
+    {
+        const Deserializer<ChunkOrder> deserializer(WORD_BITS, wide_chunk_high<Order>(high, low, k), wide_chunk_low<Order>(high, low, k));
+        deserializer.extract(buffer, words[k]);
+    }
+
+    val = wide_from_words<Order, T>(words, nbBits);
+}
+
+//-----------------------------------------------------------------------------
+template<bits_order Order, typename T>
+constexpr void wide_insert(const std::span<std::byte> buffer, T val, size_t high, size_t low) noexcept
+{
+    using ChunkOrder = natural_bits_order_t<Order>;
+    const auto nbBits = high - low + 1;
+    const auto words = wide_to_words<Order>(val, nbBits);
+
+    for(size_t k=0; (k * WORD_BITS) < nbBits; k++)
+    {
+        const Serializer<ChunkOrder> serializer(wide_chunk_high<Order>(high, low, k), wide_chunk_low<Order>(high, low, k));
+        serializer.insert(words[k], buffer);
+    }
+}
+
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, bits_order Order, typename T>
+constexpr void wide_extract(const std::span<const std::byte> buffer, T & val) noexcept
+{
+    using ChunkOrder = natural_bits_order_t<Order>;
+    constexpr auto nbBits = high - low + 1;
+    constexpr auto nbChunks = (nbBits + WORD_BITS - 1) / WORD_BITS;
+    wide_words_t<T> words = {};
+
+    [&]<size_t... K>(std::index_sequence<K...>) {
+        ((words[K] = StaticDeserializer<wide_chunk_high<Order>(high, low, K), wide_chunk_low<Order>(high, low, K), ChunkOrder>::extract_raw(buffer)), ...);
+    }(std::make_index_sequence<nbChunks>());
+
+    val = wide_from_words<Order, T>(words, nbBits);
+}
+
+//-----------------------------------------------------------------------------
+template<size_t high, size_t low, bits_order Order, typename T>
+constexpr void wide_insert(const std::span<std::byte> buffer, T val) noexcept
+{
+    using ChunkOrder = natural_bits_order_t<Order>;
+    constexpr auto nbBits = high - low + 1;
+    constexpr auto nbChunks = (nbBits + WORD_BITS - 1) / WORD_BITS;
+    const auto words = wide_to_words<Order>(val, nbBits);
+
+    [&]<size_t... K>(std::index_sequence<K...>) {
+        (StaticSerializer<wide_chunk_high<Order>(high, low, K), wide_chunk_low<Order>(high, low, K), ChunkOrder>::insert(words[K], buffer), ...);
+    }(std::make_index_sequence<nbChunks>());
+}
+
+} // namespace bits::detail
+
+#endif /* BITS_DETAIL_WIDE_INTEGER_H */
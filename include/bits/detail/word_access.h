@@ -0,0 +1,239 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                    bits
+//
+// This file is distributed under the 3-clause Berkeley Software Distribution
+// License. See LICENSE for details.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BITS_DETAIL_WORD_ACCESS_H
+#define BITS_DETAIL_WORD_ACCESS_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <climits>
+#include <bit>
+#include <span>
+#include <type_traits>
+#include <concepts>
+
+#include <bits/detail/underlying_integral_type.h>
+
+namespace bits::detail {
+
+//-----------------------------------------------------------------------------
+//- Word used by the word-at-a-time de/serialization kernels
+//-----------------------------------------------------------------------------
+using word_t = uint64_t;
+
+inline constexpr size_t WORD_BYTES = sizeof(word_t);
+inline constexpr size_t WORD_BITS  = WORD_BYTES * CHAR_BIT;
+
+//-----------------------------------------------------------------------------
+//- Byte swapping and bits masking helpers
+//-----------------------------------------------------------------------------
+template<std::unsigned_integral U>
+inline constexpr U      byteswap(U val) noexcept;
+inline constexpr word_t mask_64bits(size_t nbBits) noexcept;
+inline constexpr word_t swap_value_bytes(word_t val, size_t nbBits) noexcept;
+
+//-----------------------------------------------------------------------------
+//- Unaligned load / store of exactly N bytes (1 to 8) with the specified
+//- bytes order, the value being right aligned into the word
+//-----------------------------------------------------------------------------
+template<size_t N, std::endian byteOrder>
+inline constexpr word_t load(const std::span<const std::byte> buffer, size_t index) noexcept;
+template<size_t N, std::endian byteOrder>
+inline constexpr void   store(const std::span<std::byte> buffer, size_t index, word_t val) noexcept;
+
+//-----------------------------------------------------------------------------
+//- Load / store of a runtime number of bytes (0 to 8), used for buffer tails
+//- and byte aligned fields
+//-----------------------------------------------------------------------------
+template<std::endian byteOrder>
+inline constexpr word_t load_partial(const std::span<const std::byte> buffer, size_t index, size_t nbBytes) noexcept;
+template<std::endian byteOrder>
+inline constexpr void   store_partial(const std::span<std::byte> buffer, size_t index, size_t nbBytes, word_t val) noexcept;
+
+
+
+//-----------------------------------------------------------------------------
+//-
+//- Implementation
+//-
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template<std::unsigned_integral U>
+inline constexpr U byteswap(U val) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr(sizeof(U) == 1)
+        return val;
+    else if constexpr(sizeof(U) == 2)
+        return __builtin_bswap16(val);
+    else if constexpr(sizeof(U) == 4)
+        return __builtin_bswap32(val);
+    else
+        return __builtin_bswap64(val);
+#else
+    U swapped = 0;
+    for(size_t i=0; i<sizeof(U); i++, val >>= 8)
+        swapped = static_cast<U>((swapped << 8) | (val & 0xFF));
+    return swapped;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+inline constexpr word_t mask_64bits(size_t nbBits) noexcept
+{
+    return nbBits < WORD_BITS ? (word_t(1) << nbBits) - 1 : ~word_t(0);
+}
+
+//-----------------------------------------------------------------------------
+//- Reverse the bytes order of a right aligned value of 'nbBits' bits
+//- (should be a whole number of bytes)
+//-----------------------------------------------------------------------------
+inline constexpr word_t swap_value_bytes(word_t val, size_t nbBits) noexcept
+{
+    return byteswap(val) >> (WORD_BITS - nbBits);
+}
+
+//-----------------------------------------------------------------------------
+template<size_t N, std::endian byteOrder>
+inline constexpr word_t load(const std::span<const std::byte> buffer, size_t index) noexcept
+{
+    static_assert(N >= 1 and N <= WORD_BYTES);
+
+    if(std::is_constant_evaluated())
+        return load_partial<byteOrder>(buffer, index, N);
+
+    if constexpr(N == 1)
+        return std::to_integer<word_t>(buffer[index]);
+    else if constexpr(N == 2 or N == 4 or N == 8)
+    {
+        typename underlying_integral_type<N, false>::type val;
+        std::memcpy(&val, buffer.data() + index, N);
+        if constexpr(byteOrder != std::endian::native)
+            val = byteswap(val);
+        return val;
+    }
+    else
+    {
+        // Copy bytes into the least significant part of the word, in native order
+        word_t word = 0;
+        if constexpr(std::endian::native == std::endian::little)
+            std::memcpy(&word, buffer.data() + index, N);
+        else
+            std::memcpy(reinterpret_cast<std::byte *>(&word) + WORD_BYTES - N, buffer.data() + index, N);
+
+        if constexpr(byteOrder != std::endian::native)
+            word = byteswap(word) >> ((WORD_BYTES - N) * CHAR_BIT);
+        return word;
+    }
+}
+
+//-----------------------------------------------------------------------------
+template<size_t N, std::endian byteOrder>
+inline constexpr void store(const std::span<std::byte> buffer, size_t index, word_t val) noexcept
+{
+    static_assert(N >= 1 and N <= WORD_BYTES);
+
+    if(std::is_constant_evaluated())
+        return store_partial<byteOrder>(buffer, index, N, val);
+
+    if constexpr(N == 1)
+        buffer[index] = std::byte(val);
+    else if constexpr(N == 2 or N == 4 or N == 8)
+    {
+        auto narrowVal = static_cast<typename underlying_integral_type<N, false>::type>(val);
+        if constexpr(byteOrder != std::endian::native)
+            narrowVal = byteswap(narrowVal);
+        std::memcpy(buffer.data() + index, &narrowVal, N);
+    }
+    else if constexpr(byteOrder == std::endian::native)
+    {
+        // Bytes are in the least significant part of the word, in native order
+        if constexpr(std::endian::native == std::endian::little)
+            std::memcpy(buffer.data() + index, &val, N);
+        else
+            std::memcpy(buffer.data() + index, reinterpret_cast<const std::byte *>(&val) + WORD_BYTES - N, N);
+    }
+    else
+    {
+        // Swap bytes so that the first byte to store is at the lowest address
+        if constexpr(std::endian::native == std::endian::little)
+            val = byteswap(val << ((WORD_BYTES - N) * CHAR_BIT));
+        else
+            val = byteswap(val);
+        std::memcpy(buffer.data() + index, &val, N);
+    }
+}
+
+//-----------------------------------------------------------------------------
+template<std::endian byteOrder>
+inline constexpr word_t load_partial(const std::span<const std::byte> buffer, size_t index, size_t nbBytes) noexcept
+{
+    word_t word = 0;
+
+    if(not std::is_constant_evaluated() and nbBytes != 0)
+    {
+        // Copy bytes into the least significant part of the word, in native order
+        if constexpr(std::endian::native == std::endian::little)
+            std::memcpy(&word, buffer.data() + index, nbBytes);
+        else
+            std::memcpy(reinterpret_cast<std::byte *>(&word) + WORD_BYTES - nbBytes, buffer.data() + index, nbBytes);
+
+        if constexpr(byteOrder != std::endian::native)
+            word = byteswap(word) >> ((WORD_BYTES - nbBytes) * CHAR_BIT);
+        return word;
+    }
+
+    for(size_t i=0; i<nbBytes; i++)
+    {
+        if constexpr(byteOrder == std::endian::big)
+            word = (word << 8) | std::to_integer<word_t>(buffer[index + i]);
+        else
+            word |= std::to_integer<word_t>(buffer[index + i]) << (i * CHAR_BIT);
+    }
+
+    return word;
+}
+
+//-----------------------------------------------------------------------------
+template<std::endian byteOrder>
+inline constexpr void store_partial(const std::span<std::byte> buffer, size_t index, size_t nbBytes, word_t val) noexcept
+{
+    if(not std::is_constant_evaluated() and nbBytes != 0)
+    {
+        if constexpr(byteOrder == std::endian::native)
+        {
+            // Bytes are in the least significant part of the word, in native order
+            if constexpr(std::endian::native == std::endian::little)
+                std::memcpy(buffer.data() + index, &val, nbBytes);
+            else
+                std::memcpy(buffer.data() + index, reinterpret_cast<const std::byte *>(&val) + WORD_BYTES - nbBytes, nbBytes);
+        }
+        else
+        {
+            // Swap bytes so that the first byte to store is at the lowest address
+            if constexpr(std::endian::native == std::endian::little)
+                val = byteswap(val << ((WORD_BYTES - nbBytes) * CHAR_BIT));
+            else
+                val = byteswap(val);
+            std::memcpy(buffer.data() + index, &val, nbBytes);
+        }
+        return;
+    }
+
+    for(size_t i=0; i<nbBytes; i++)
+    {
+        if constexpr(byteOrder == std::endian::big)
+            buffer[index + i] = std::byte(val >> ((nbBytes - i - 1) * CHAR_BIT));
+        else
+            buffer[index + i] = std::byte(val >> (i * CHAR_BIT));
+    }
+}
+
+} // namespace bits::detail
+
+#endif /* BITS_DETAIL_WORD_ACCESS_H */